@@ -12,6 +12,7 @@
 
 @property (assign, nonatomic) CGFloat regularHeight;
 @property (strong, nonatomic) UIView *separatorView;
+@property (strong, nonatomic) UIView *defaultBackgroundView;
 
 @end
 
@@ -44,6 +45,7 @@ const CGFloat MMSnapFooterFlexibleWidth = CGFLOAT_MAX;
 #endif
         
         _backgroundView = backgroundView;
+        _defaultBackgroundView = backgroundView;
         
         [self addSubview:backgroundView];
         
@@ -212,6 +214,16 @@ static const NSString *MMSnapFooterInfoSizeKey = @"Size";
     return size;
 }
 
+#pragma mark - Reuse.
+
+- (void)prepareForReuse
+{
+    [super prepareForReuse];
+    
+    self.items = nil;
+    self.backgroundView = self.defaultBackgroundView;
+}
+
 #pragma mark - Properties.
 
 - (void)setItems:(NSArray *)items
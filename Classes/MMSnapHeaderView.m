@@ -9,6 +9,14 @@
 #import "MMSnapHeaderView.h"
 #import "MMSplitViewController+MMSupplementaryBars.h"
 
+typedef NS_ENUM(NSUInteger, _MMSnapHeaderTextRole) {
+    _MMSnapHeaderTextRoleTitle,
+    _MMSnapHeaderTextRoleSubtitle,
+    _MMSnapHeaderTextRoleLargeTitle,
+    _MMSnapHeaderTextRoleBackButtonTitle,
+    _MMSnapHeaderTextRoleCount
+};
+
 @interface MMSnapHeaderView () {
     struct {
         unsigned int usingMultilineHeading : 1;
@@ -21,7 +29,10 @@
         unsigned int showsHeading: 1;
     } _configurationOptions;
     
-    CGSize _largeTitleSize;
+    // Text metrics. The key identifies the text and font each size belongs to, and pending sizes are being prefetched while off screen:
+    CGSize _textSizes[_MMSnapHeaderTextRoleCount];
+    NSString *_textMeasurementKeys[_MMSnapHeaderTextRoleCount];
+    BOOL _textSizesPending[_MMSnapHeaderTextRoleCount];
 }
 
 @property (strong, nonatomic) UILabel *titleLabel;
@@ -40,6 +51,7 @@
 @property (assign, nonatomic) CGFloat backButtonSpacing;
 
 @property (strong, nonatomic) UIView *separatorView;
+@property (strong, nonatomic) UIView *defaultBackgroundView;
 @property (strong, nonatomic) UIView *largeHeaderContainer;
 @property (strong, nonatomic) UIView *largeHeaderSeparatorView;
 
@@ -48,12 +60,31 @@
 @property (assign, nonatomic) CGFloat largeHeaderScaleFactor;
 @property (assign, nonatomic) BOOL contentIsBeingScrolled;
 
+- (BOOL)_applyMeasuredTextSize:(CGSize)size forRole:(_MMSnapHeaderTextRole)role key:(NSString *)key;
+- (void)_textMetricsDidChange;
+
 @end
 
 @interface _MMSnapHeaderContainerView : UIView
 
 @end
 
+@interface _MMSnapHeaderTextMeasurer : NSObject
+
++ (instancetype)sharedMeasurer;
+
+- (NSString *)keyForText:(NSString *)text font:(UIFont *)font;
+- (BOOL)getCachedSize:(CGSize *)size forKey:(NSString *)key;
+- (CGSize)sizeForText:(NSString *)text font:(UIFont *)font key:(NSString *)key;
+- (void)prefetchText:(NSString *)text font:(UIFont *)font key:(NSString *)key role:(_MMSnapHeaderTextRole)role forHeaderView:(MMSnapHeaderView *)headerView;
+
+@end
+
+NS_INLINE CGSize MMSnapHeaderMeasuredTextSize(NSString *text, UIFont *font){
+    const CGRect rect = [text boundingRectWithSize:(CGSize){ CGFLOAT_MAX, CGFLOAT_MAX } options:NSStringDrawingUsesLineFragmentOrigin attributes:@{ NSFontAttributeName : font } context:nil];
+    return (CGSize){ ceil(CGRectGetWidth(rect)), ceil(CGRectGetHeight(rect)) };
+};
+
 @implementation MMSnapHeaderView
 
 static const CGFloat headerScaleDelta = 0.1f;
@@ -80,7 +111,6 @@ static const CGFloat maximumScale = 1.0f + headerScaleDelta;
         
         // Defaults.
         _separatorColor = [UIColor colorWithWhite:0.0f alpha:0.2f];
-        _largeTitleSize = CGSizeZero;
         
         // Configuration.
         _configurationOptions.showsHeading = YES;
@@ -97,6 +127,7 @@ static const CGFloat maximumScale = 1.0f + headerScaleDelta;
 #endif
         
         _backgroundView = backgroundView;
+        _defaultBackgroundView = backgroundView;
         
         [self addSubview:backgroundView];
         
@@ -228,6 +259,107 @@ static const CGFloat maximumScale = 1.0f + headerScaleDelta;
         _largeTitleLabel.font = [UIFont systemFontOfSize:largeHeadingPointSize weight:UIFontWeightBold];
     }
 #endif
+    
+    [self _updateTextMetrics];
+}
+
+#pragma mark - Text metrics.
+
+- (void)_updateTextMetrics
+{
+    NSString *texts[_MMSnapHeaderTextRoleCount] = {
+        _titleLabel.text,
+        _subtitleLabel.text,
+        _largeTitleLabel.text,
+        [_regularBackButton titleForState:UIControlStateNormal]
+    };
+    
+    UIFont *fonts[_MMSnapHeaderTextRoleCount] = {
+        _titleLabel.font,
+        _subtitleLabel.font,
+        _largeTitleLabel.font,
+        _regularBackButton.titleLabel.font
+    };
+    
+    _MMSnapHeaderTextMeasurer *measurer = [_MMSnapHeaderTextMeasurer sharedMeasurer];
+    
+    for (_MMSnapHeaderTextRole role = 0; role < _MMSnapHeaderTextRoleCount; role++) {
+        NSString *text = texts[role];
+        UIFont *font = fonts[role];
+        NSString *key = (text.length > 0 && font != nil) ? [measurer keyForText:text font:font] : nil;
+        
+        if (key == _textMeasurementKeys[role] || [key isEqualToString:_textMeasurementKeys[role]]) {
+            continue;
+        }
+        
+        _textMeasurementKeys[role] = key;
+        _textSizesPending[role] = NO;
+        
+        if (key == nil) {
+            _textSizes[role] = CGSizeZero;
+            continue;
+        }
+        
+        CGSize size = CGSizeZero;
+        
+        if ([measurer getCachedSize:&size forKey:key]) {
+            _textSizes[role] = size;
+        } else if (self.window != nil) {
+            // On screen, an estimate would make the title jump once measured, so measure now:
+            _textSizes[role] = [measurer sizeForText:text font:font key:key];
+        } else {
+            // Off screen, prefetch in the background. The size is resolved when the header moves to a window:
+            _textSizes[role] = CGSizeZero;
+            _textSizesPending[role] = YES;
+            
+            [measurer prefetchText:text font:font key:key role:role forHeaderView:self];
+        }
+    }
+}
+
+- (BOOL)_resolvePendingTextMetrics
+{
+    BOOL hasPendingTextSizes = NO;
+    
+    // Forget the pending keys, so they are measured again now that the header is on screen. Prefetched sizes come from the cache:
+    for (_MMSnapHeaderTextRole role = 0; role < _MMSnapHeaderTextRoleCount; role++) {
+        if (_textSizesPending[role]) {
+            _textMeasurementKeys[role] = nil;
+            _textSizes[role] = CGSizeZero;
+            _textSizesPending[role] = NO;
+            
+            hasPendingTextSizes = YES;
+        }
+    }
+    
+    if (hasPendingTextSizes) {
+        [self _updateTextMetrics];
+    }
+    
+    return hasPendingTextSizes;
+}
+
+- (BOOL)_applyMeasuredTextSize:(CGSize)size forRole:(_MMSnapHeaderTextRole)role key:(NSString *)key
+{
+    // The text or font may have changed while measuring, or the size was already resolved on screen:
+    if (![key isEqualToString:_textMeasurementKeys[role]] || !_textSizesPending[role]) {
+        return NO;
+    }
+    
+    _textSizes[role] = size;
+    _textSizesPending[role] = NO;
+    
+    return YES;
+}
+
+- (void)_textMetricsDidChange
+{
+    // The large title width decides whether the large title fits:
+    if (self.displaysLargeTitle) {
+        [self sizeToFit];
+    }
+    
+    [self setNeedsLayout];
 }
 
 #pragma mark - Actions.
@@ -313,8 +445,8 @@ static const CGFloat maximumScale = 1.0f + headerScaleDelta;
     if (usesCustomTitleView) {
         sizeNeededToFitTitle = [_titleView sizeThatFits:fit];
     } else {
-        tSize = [_titleLabel sizeThatFits:fit];
-        sSize = [_subtitleLabel sizeThatFits:fit];
+        tSize = _textSizes[_MMSnapHeaderTextRoleTitle];
+        sSize = _textSizes[_MMSnapHeaderTextRoleSubtitle];
         
         if (usesMultilineHeading) {
             sizeNeededToFitTitle = CGSizeMake(MAX(tSize.width, sSize.width), tSize.height + sSize.height);
@@ -333,7 +465,8 @@ static const CGFloat maximumScale = 1.0f + headerScaleDelta;
             }
             
             CGFloat availableTitleBackWidth = CGRectGetWidth(contentRect) - rightCompression - edgeSpacing;
-            CGFloat regularBackButtonWidth = [_regularBackButton sizeThatFits:fit].width;
+            const UIEdgeInsets regularBackButtonInsets = _regularBackButton.contentEdgeInsets;
+            CGFloat regularBackButtonWidth = [_regularBackButton imageForState:UIControlStateNormal].size.width + _textSizes[_MMSnapHeaderTextRoleBackButtonTitle].width + regularBackButtonInsets.left + regularBackButtonInsets.right;
             
             useRegularBackButton = (regularBackButtonWidth + interSpacing + sizeNeededToFitTitle.width < availableTitleBackWidth);
             if (useRegularBackButton) {
@@ -421,7 +554,7 @@ static const CGFloat maximumScale = 1.0f + headerScaleDelta;
         
         const CGFloat regularHeight = _regularHeight;
         const CGFloat largeHeaderHeight = _largeHeaderHeight;
-        const CGSize calculatedTitleSize = _largeTitleSize;
+        const CGSize calculatedTitleSize = _textSizes[_MMSnapHeaderTextRoleLargeTitle];
         
         CGSize largeHeaderSize = calculatedTitleSize;
         largeHeaderSize.width = CGRectGetWidth(largeContentRect);
@@ -546,10 +679,45 @@ static const CGFloat maximumScale = 1.0f + headerScaleDelta;
     [super didMoveToWindow];
     
     if (self.window != nil) {
+        // Never show a header whose text wasn't measured yet:
+        if ([self _resolvePendingTextMetrics]) {
+            [self _textMetricsDidChange];
+        }
+        
         [self setNeedsLayout];
     }
 }
 
+#pragma mark - Reuse.
+
+- (void)prepareForReuse
+{
+    [super prepareForReuse];
+    
+    // Appearance attributes are shared by all headers, so only reset what belongs to the view controller:
+    self.title = nil;
+    self.subtitle = nil;
+    self.titleView = nil;
+    self.leftButton = nil;
+    self.rightView = nil;
+    self.hidesBackButton = NO;
+    self.displaysLargeTitle = NO;
+    self.backgroundView = self.defaultBackgroundView;
+    self.backActionAvailable = NO;
+    self.rotatesBackButton = NO;
+    self.contentIsBeingScrolled = NO;
+    self.largeHeaderScaleFactor = 1.0f;
+    self.headingContainer.alpha = 1.0f;
+    
+    _backButtonTitle = nil;
+    _configurationOptions.showsHeading = YES;
+    
+    [self.regularBackButton setTitle:nil forState:UIControlStateNormal];
+    [self _updateTextMetrics];
+    
+    [self sizeToFit];
+}
+
 #pragma mark - Updates.
 
 - (void)snapControllerWillDisplayViewController
@@ -560,6 +728,7 @@ static const CGFloat maximumScale = 1.0f + headerScaleDelta;
         NSString *backTitle = headerView.backButtonTitle ?: headerView.title ?: previousViewController.title;
         
         [self.regularBackButton setTitle:backTitle forState:UIControlStateNormal];
+        [self _updateTextMetrics];
         
         [self setBackActionAvailable:(previousViewController != nil)];
         [self setNeedsLayout];
@@ -650,7 +819,6 @@ static const CGFloat maximumScale = 1.0f + headerScaleDelta;
         _title = title;
         _titleLabel.text = title;
         _largeTitleLabel.text = title;
-        _largeTitleSize = [_largeTitleLabel sizeThatFits:(CGSize){ CGFLOAT_MAX, CGFLOAT_MAX }];
         
         [self _assignFonts];
         [self setNeedsLayout];
@@ -804,7 +972,7 @@ static const CGFloat maximumScale = 1.0f + headerScaleDelta;
         const CGFloat spacing = [self.class _UINavigationBarDoubleEdgesRequired] ? [self.class _UINavigationBarDoubleEdgesSpacing] :  _barButtonSpacing;
         const CGFloat allowedWidth = size.width - (spacing * 2.0f);
         
-        if ((_largeTitleSize.width * maximumScale) > allowedWidth) {
+        if ((_textSizes[_MMSnapHeaderTextRoleLargeTitle].width * maximumScale) > allowedWidth) {
             return NO;
         }
         
@@ -934,3 +1102,149 @@ static const CGFloat maximumScale = 1.0f + headerScaleDelta;
 }
 
 @end
+
+@interface _MMSnapHeaderTextMeasurement : NSObject
+
+@property (copy, nonatomic) NSString *text;
+@property (strong, nonatomic) UIFont *font;
+@property (copy, nonatomic) NSString *key;
+@property (assign, nonatomic) _MMSnapHeaderTextRole role;
+@property (weak, nonatomic) MMSnapHeaderView *headerView;
+
+@end
+
+@implementation _MMSnapHeaderTextMeasurement
+
+@end
+
+@interface _MMSnapHeaderTextMeasurer ()
+
+@property (strong, nonatomic) NSCache <NSString *, NSValue *> *cache;
+@property (strong, nonatomic) NSMutableArray <_MMSnapHeaderTextMeasurement *> *pendingMeasurements;
+
+@end
+
+@implementation _MMSnapHeaderTextMeasurer
+
++ (instancetype)sharedMeasurer
+{
+    static _MMSnapHeaderTextMeasurer *sharedMeasurer;
+    static dispatch_once_t onceToken;
+    dispatch_once(&onceToken, ^{
+        sharedMeasurer = [[self alloc] init];
+    });
+    return sharedMeasurer;
+}
+
+- (instancetype)init
+{
+    self = [super init];
+    if (self) {
+        _cache = [[NSCache alloc] init];
+        _cache.countLimit = 512;
+        _pendingMeasurements = [NSMutableArray array];
+    }
+    return self;
+}
+
+- (NSString *)keyForText:(NSString *)text font:(UIFont *)font
+{
+    return [NSString stringWithFormat:@"%@-%.2f-%@", font.fontName, font.pointSize, text];
+}
+
+- (BOOL)getCachedSize:(CGSize *)size forKey:(NSString *)key
+{
+    NSValue *value = [self.cache objectForKey:key];
+    if (value) {
+        *size = value.CGSizeValue;
+        return YES;
+    }
+    return NO;
+}
+
+- (CGSize)sizeForText:(NSString *)text font:(UIFont *)font key:(NSString *)key
+{
+    NSAssert([NSThread isMainThread], @"Synchronous text measurements must be made on the main thread.");
+    
+    CGSize size = CGSizeZero;
+    
+    if (![self getCachedSize:&size forKey:key]) {
+        size = MMSnapHeaderMeasuredTextSize(text, font);
+        
+        [self.cache setObject:[NSValue valueWithCGSize:size] forKey:key];
+    }
+    
+    return size;
+}
+
+- (void)prefetchText:(NSString *)text font:(UIFont *)font key:(NSString *)key role:(_MMSnapHeaderTextRole)role forHeaderView:(MMSnapHeaderView *)headerView
+{
+    NSAssert([NSThread isMainThread], @"Text measurements must be requested on the main thread.");
+    
+    _MMSnapHeaderTextMeasurement *measurement = [[_MMSnapHeaderTextMeasurement alloc] init];
+    measurement.text = text;
+    measurement.font = font;
+    measurement.key = key;
+    measurement.role = role;
+    measurement.headerView = headerView;
+    
+    [self.pendingMeasurements addObject:measurement];
+    
+    // Wait for the rest of this run loop turn, so headers configured together are measured together:
+    if (self.pendingMeasurements.count == 1) {
+        dispatch_async(dispatch_get_main_queue(), ^{
+            [self _measurePendingMeasurements];
+        });
+    }
+}
+
+- (void)_measurePendingMeasurements
+{
+    NSArray <_MMSnapHeaderTextMeasurement *> *measurements = [self.pendingMeasurements copy];
+    
+    [self.pendingMeasurements removeAllObjects];
+    
+    // Measure each text and font once, no matter how many headers show it:
+    NSMutableDictionary <NSString *, _MMSnapHeaderTextMeasurement *> *uniqueMeasurements = [NSMutableDictionary dictionaryWithCapacity:measurements.count];
+    for (_MMSnapHeaderTextMeasurement *measurement in measurements) {
+        if (!uniqueMeasurements[measurement.key]) {
+            uniqueMeasurements[measurement.key] = measurement;
+        }
+    }
+    
+    dispatch_async(dispatch_get_global_queue(QOS_CLASS_USER_INITIATED, 0), ^{
+        NSMutableDictionary <NSString *, NSValue *> *sizes = [NSMutableDictionary dictionaryWithCapacity:uniqueMeasurements.count];
+        
+        [uniqueMeasurements enumerateKeysAndObjectsUsingBlock:^(NSString *key, _MMSnapHeaderTextMeasurement *measurement, BOOL *stop) {
+            sizes[key] = [NSValue valueWithCGSize:MMSnapHeaderMeasuredTextSize(measurement.text, measurement.font)];
+        }];
+        
+        dispatch_async(dispatch_get_main_queue(), ^{
+            [self _applySizes:sizes toMeasurements:measurements];
+        });
+    });
+}
+
+- (void)_applySizes:(NSDictionary <NSString *, NSValue *> *)sizes toMeasurements:(NSArray <_MMSnapHeaderTextMeasurement *> *)measurements
+{
+    [sizes enumerateKeysAndObjectsUsingBlock:^(NSString *key, NSValue *value, BOOL *stop) {
+        [self.cache setObject:value forKey:key];
+    }];
+    
+    // Apply everything first, then lay out each header once:
+    NSHashTable <MMSnapHeaderView *> *updatedHeaderViews = [NSHashTable weakObjectsHashTable];
+    
+    for (_MMSnapHeaderTextMeasurement *measurement in measurements) {
+        MMSnapHeaderView *headerView = measurement.headerView;
+        
+        if ([headerView _applyMeasuredTextSize:sizes[measurement.key].CGSizeValue forRole:measurement.role key:measurement.key]) {
+            [updatedHeaderViews addObject:headerView];
+        }
+    }
+    
+    for (MMSnapHeaderView *headerView in updatedHeaderViews) {
+        [headerView _textMetricsDidChange];
+    }
+}
+
+@end
@@ -7,6 +7,7 @@
 //
 
 #import <UIKit/UIKit.h>
+#import "MMSplitReusePool.h"
 
 @class MMSplitViewController;
 
@@ -15,7 +16,7 @@ NS_ASSUME_NONNULL_BEGIN
 /**
  *  The base class for the @c MMSnapHeaderView and @c MMSnapFooterView classes.
  */
-@interface MMSnapSupplementaryView : UIView
+@interface MMSnapSupplementaryView : UIView <MMSplitReusableView>
 
 /**
  *  Called just before the snap controller displays the view controller's view associated to this supplementary view.
@@ -44,6 +45,11 @@ NS_ASSUME_NONNULL_BEGIN
  */
 - (void)snapControllerViewControllersDidChange;
 
+/**
+ *  Resets the view before it is handed to another view controller. Subclasses must reset any state specific to their view controller.
+ */
+- (void)prepareForReuse NS_REQUIRES_SUPER;
+
 /**
  *  The split view controller of the recipient.
  */
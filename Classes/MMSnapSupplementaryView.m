@@ -61,4 +61,10 @@
     
 }
 
+- (void)prepareForReuse
+{
+    self.splitViewController = nil;
+    self.viewController = nil;
+}
+
 @end
@@ -0,0 +1,131 @@
+//
+//  MMSplitEventStream.h
+//  MMSplitViewController
+//
+//  Created by Matías Martínez on 3/11/19.
+//  Copyright © 2019 Matías. All rights reserved.
+//
+
+#import <Foundation/Foundation.h>
+#import <CoreGraphics/CoreGraphics.h>
+
+NS_ASSUME_NONNULL_BEGIN
+
+/**
+ *  Constants describing the kind of an event published by a split view controller.
+ */
+typedef NS_ENUM(uint8_t, MMSplitEventType) {
+    /**
+     *  A column is about to be displayed.
+     */
+    MMSplitEventTypeWillDisplay,
+    
+    /**
+     *  A column ended being displayed.
+     */
+    MMSplitEventTypeDidEndDisplaying,
+    
+    /**
+     *  The split view is about to snap to a column.
+     */
+    MMSplitEventTypeWillSnap,
+    
+    /**
+     *  The split view finished snapping to a column.
+     */
+    MMSplitEventTypeDidSnap,
+    
+    /**
+     *  The display mode is about to change.
+     */
+    MMSplitEventTypeWillChangeDisplayMode,
+    
+    /**
+     *  The layout of the split view controller changed: its bounds size, its display mode or the column it snapped to.
+     */
+    MMSplitEventTypeLayout,
+};
+
+/**
+ *  A compact record of an event published by a split view controller.
+ *
+ *  @note Records don't reference view controllers, so they can be safely consumed from any thread. Columns are identified by their index.
+ */
+typedef struct MMSplitEvent {
+    /**
+     *  The time the event was published, as returned by @c CFAbsoluteTimeGetCurrent().
+     */
+    CFAbsoluteTime timestamp;
+    
+    /**
+     *  The kind of event.
+     */
+    MMSplitEventType type;
+    
+    /**
+     *  The raw value of the display mode, for display mode and layout events.
+     */
+    uint8_t displayMode;
+    
+    /**
+     *  The index of the column, or @c NSNotFound if the event is not about a column.
+     */
+    NSUInteger columnIndex;
+    
+    /**
+     *  The bounds size and content offset of the split view, for layout events.
+     */
+    CGSize boundsSize;
+    CGPoint contentOffset;
+} MMSplitEvent;
+
+/**
+ *  A block that consumes a batch of events, in the order they were published.
+ *
+ *  @param events A buffer with the events. The buffer is only valid until the block returns.
+ *  @param count  The number of events in the buffer.
+ */
+typedef void (^MMSplitEventStreamHandler)(const MMSplitEvent *events, NSUInteger count);
+
+/**
+ *  An object that buffers events in a bounded ring buffer and drains them on a queue of your choice.
+ *
+ *  Publishing never blocks and never waits on the handler: when the buffer is full, the event is dropped and counted instead. The stream supports a single publishing thread, typically the main thread.
+ */
+@interface MMSplitEventStream : NSObject
+
+/**
+ *  Returns a new event stream.
+ *
+ *  @param capacity The maximum number of events waiting to be drained. The value is rounded up to a power of two.
+ *  @param queue    The queue the handler is called on.
+ *  @param handler  The block that consumes the events.
+ *
+ *  @return An event stream instance.
+ */
+- (instancetype)initWithCapacity:(NSUInteger)capacity queue:(dispatch_queue_t)queue handler:(MMSplitEventStreamHandler)handler NS_DESIGNATED_INITIALIZER;
+
+- (instancetype)init NS_UNAVAILABLE;
+
+/**
+ *  The maximum number of events waiting to be drained.
+ */
+@property (readonly, nonatomic) NSUInteger capacity;
+
+/**
+ *  The number of events dropped because the buffer was full.
+ */
+@property (readonly, nonatomic) uint64_t droppedEventCount;
+
+/**
+ *  Publishes an event, stamping it with the current time.
+ *
+ *  @param event The event to publish.
+ *
+ *  @return @c YES if the event was buffered, or @c NO if it was dropped.
+ */
+- (BOOL)publishEvent:(MMSplitEvent)event;
+
+@end
+
+NS_ASSUME_NONNULL_END
@@ -0,0 +1,129 @@
+//
+//  MMSplitEventStream.m
+//  MMSplitViewController
+//
+//  Created by Matías Martínez on 3/11/19.
+//  Copyright © 2019 Matías. All rights reserved.
+//
+
+#import "MMSplitEventStream.h"
+#import <stdatomic.h>
+
+@interface MMSplitEventStream () {
+    MMSplitEvent *_events;
+    NSUInteger _mask;
+    
+    // The producer only writes the head, and the consumer only writes the tail:
+    _Atomic(NSUInteger) _head;
+    _Atomic(NSUInteger) _tail;
+    _Atomic(uint64_t) _droppedEventCount;
+    atomic_flag _drainScheduled;
+}
+
+@property (strong, nonatomic) dispatch_queue_t queue;
+@property (copy, nonatomic) MMSplitEventStreamHandler handler;
+
+@end
+
+NS_INLINE NSUInteger MMSplitEventStreamCapacityForProposedCapacity(NSUInteger capacity){
+    NSUInteger result = 1;
+    while (result < capacity && result < (NSUIntegerMax >> 1)) {
+        result <<= 1;
+    }
+    return result;
+};
+
+@implementation MMSplitEventStream
+
+- (instancetype)initWithCapacity:(NSUInteger)capacity queue:(dispatch_queue_t)queue handler:(MMSplitEventStreamHandler)handler
+{
+    NSParameterAssert(queue);
+    NSParameterAssert(handler);
+    
+    self = [super init];
+    if (self) {
+        _capacity = MMSplitEventStreamCapacityForProposedCapacity(MAX(capacity, 2));
+        _mask = _capacity - 1;
+        _events = calloc(_capacity, sizeof(MMSplitEvent));
+        _queue = queue;
+        _handler = [handler copy];
+        
+        atomic_init(&_head, 0);
+        atomic_init(&_tail, 0);
+        atomic_init(&_droppedEventCount, 0);
+        atomic_flag_clear(&_drainScheduled);
+    }
+    return self;
+}
+
+- (void)dealloc
+{
+    free(_events);
+}
+
+- (uint64_t)droppedEventCount
+{
+    return atomic_load_explicit(&_droppedEventCount, memory_order_relaxed);
+}
+
+- (BOOL)publishEvent:(MMSplitEvent)event
+{
+    const NSUInteger head = atomic_load_explicit(&_head, memory_order_relaxed);
+    const NSUInteger tail = atomic_load_explicit(&_tail, memory_order_acquire);
+    
+    if (head - tail >= _capacity) {
+        atomic_fetch_add_explicit(&_droppedEventCount, 1, memory_order_relaxed);
+        return NO;
+    }
+    
+    event.timestamp = CFAbsoluteTimeGetCurrent();
+    
+    _events[head & _mask] = event;
+    
+    atomic_store(&_head, head + 1);
+    
+    [self scheduleDrainIfNeeded];
+    
+    return YES;
+}
+
+- (void)scheduleDrainIfNeeded
+{
+    if (atomic_flag_test_and_set(&_drainScheduled)) {
+        return;
+    }
+    
+    dispatch_async(self.queue, ^{
+        [self drain];
+    });
+}
+
+- (void)drain
+{
+    MMSplitEventStreamHandler handler = self.handler;
+    
+    while (YES) {
+        const NSUInteger tail = atomic_load_explicit(&_tail, memory_order_relaxed);
+        const NSUInteger head = atomic_load_explicit(&_head, memory_order_acquire);
+        
+        if (head != tail) {
+            // Hand out contiguous runs; the producer can't reuse these slots until the tail moves:
+            const NSUInteger start = tail & _mask;
+            const NSUInteger count = MIN(head - tail, _capacity - start);
+            
+            handler(_events + start, count);
+            
+            atomic_store_explicit(&_tail, tail + count, memory_order_release);
+            continue;
+        }
+        
+        atomic_flag_clear(&_drainScheduled);
+        
+        // Sequentially consistent, so an event published meanwhile either sees the cleared flag or is seen here:
+        if (atomic_load(&_head) == head || atomic_flag_test_and_set(&_drainScheduled)) {
+            break;
+        }
+    }
+}
+
+@end
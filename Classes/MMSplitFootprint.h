@@ -0,0 +1,143 @@
+//
+//  MMSplitFootprint.h
+//  MMSplitViewController
+//
+//  Created by Matías Martínez on 3/12/19.
+//  Copyright © 2019 Matías. All rights reserved.
+//
+
+#import <UIKit/UIKit.h>
+
+NS_ASSUME_NONNULL_BEGIN
+
+/**
+ *  The layer footprint of a part of the split interface.
+ */
+typedef struct MMSplitLayerFootprint {
+    /**
+     *  The number of layers, including masks.
+     */
+    NSUInteger layerCount;
+    
+    /**
+     *  The estimated size of the backing stores of the layers, in bytes.
+     */
+    uint64_t backingStoreBytes;
+} MMSplitLayerFootprint;
+
+/**
+ *  Returns the sum of two footprints.
+ */
+NS_INLINE MMSplitLayerFootprint MMSplitLayerFootprintAdd(MMSplitLayerFootprint footprint, MMSplitLayerFootprint otherFootprint){
+    return (MMSplitLayerFootprint){
+        .layerCount = footprint.layerCount + otherFootprint.layerCount,
+        .backingStoreBytes = footprint.backingStoreBytes + otherFootprint.backingStoreBytes
+    };
+};
+
+/**
+ *  Measures a layer tree.
+ *
+ *  Image contents are measured from the image itself. Layers that draw their own content or render a gradient are estimated from their bounds and contents scale, at four bytes per pixel. Other layers don't add to the backing store size.
+ *
+ *  @param layer          The root of the layer tree.
+ *  @param excludedLayers Layers to skip along with their sublayers, or @c nil.
+ *
+ *  @return The footprint of the layer tree.
+ */
+extern MMSplitLayerFootprint MMSplitLayerFootprintForLayerTree(CALayer *layer, NSSet <CALayer *> * _Nullable excludedLayers);
+
+/**
+ *  An object that holds the footprint of a child view controller and the pane that displays it.
+ */
+@interface MMSplitPaneFootprint : NSObject
+
+/**
+ *  Returns the footprint of the specified child view controller and pane.
+ *
+ *  The view of the child view controller is not loaded if it wasn't already.
+ *
+ *  @param viewController The child view controller.
+ *  @param paneView       The pane that displays the child view controller, or @c nil.
+ *
+ *  @return A pane footprint instance.
+ */
++ (instancetype)footprintForViewController:(UIViewController *)viewController paneView:(nullable UIView *)paneView;
+
+/**
+ *  The child view controller.
+ */
+@property (weak, nonatomic, nullable) UIViewController *viewController;
+
+/**
+ *  A Boolean value indicating whether the view of the child view controller is loaded.
+ */
+@property (assign, nonatomic, getter=isViewLoaded) BOOL viewLoaded;
+
+/**
+ *  A Boolean value indicating whether the view of the child view controller is displayed in its pane.
+ *
+ *  A detached view controller with a loaded view keeps its layers in memory even though they aren't displayed.
+ */
+@property (assign, nonatomic, getter=isAttached) BOOL attached;
+
+/**
+ *  The footprint of the view of the child view controller, excluding its header and footer views.
+ */
+@property (assign, nonatomic) MMSplitLayerFootprint contentFootprint;
+
+/**
+ *  The footprint of the header views placed in the view of the child view controller.
+ */
+@property (assign, nonatomic) MMSplitLayerFootprint headerFootprint;
+
+/**
+ *  The footprint of the footer views placed in the view of the child view controller.
+ */
+@property (assign, nonatomic) MMSplitLayerFootprint footerFootprint;
+
+/**
+ *  The footprint of the pane, excluding its content: separators, hugging overlays and containers.
+ */
+@property (assign, nonatomic) MMSplitLayerFootprint chromeFootprint;
+
+/**
+ *  The sum of all the footprints of the receiver.
+ */
+@property (readonly, nonatomic) MMSplitLayerFootprint totalFootprint;
+
+@end
+
+/**
+ *  An object that holds the footprint of a split view controller.
+ */
+@interface MMSplitFootprint : NSObject
+
+/**
+ *  The footprints of the child view controllers, in the order of the split interface.
+ */
+@property (copy, nonatomic) NSArray <MMSplitPaneFootprint *> *paneFootprints;
+
+/**
+ *  The footprint of the split view itself, excluding the panes of the child view controllers: scroll views, the shared chrome layer and rounded corner overlays.
+ */
+@property (assign, nonatomic) MMSplitLayerFootprint splitFootprint;
+
+/**
+ *  The footprint of the chrome of the split interface, including the chrome of every pane.
+ */
+@property (readonly, nonatomic) MMSplitLayerFootprint chromeFootprint;
+
+/**
+ *  The footprint of every header and footer view.
+ */
+@property (readonly, nonatomic) MMSplitLayerFootprint supplementaryFootprint;
+
+/**
+ *  The sum of all the footprints of the receiver.
+ */
+@property (readonly, nonatomic) MMSplitLayerFootprint totalFootprint;
+
+@end
+
+NS_ASSUME_NONNULL_END
@@ -0,0 +1,182 @@
+//
+//  MMSplitFootprint.m
+//  MMSplitViewController
+//
+//  Created by Matías Martínez on 3/12/19.
+//  Copyright © 2019 Matías. All rights reserved.
+//
+
+#import "MMSplitFootprint.h"
+#import "MMSplitPaneView.h"
+#import "MMSnapHeaderView.h"
+#import "MMSnapFooterView.h"
+
+NS_INLINE uint64_t MMSplitLayerBackingStoreBytes(CALayer *layer){
+    id contents = layer.contents;
+    
+    if (contents != nil && CFGetTypeID((__bridge CFTypeRef)contents) == CGImageGetTypeID()) {
+        CGImageRef image = (__bridge CGImageRef)contents;
+        return (uint64_t)CGImageGetBytesPerRow(image) * CGImageGetHeight(image);
+    }
+    
+    BOOL rendersContent = (contents != nil || [layer isKindOfClass:[CAGradientLayer class]]);
+    
+    // Views only get a backing store when they draw their own content:
+    if (!rendersContent && [layer.delegate isKindOfClass:[UIView class]]) {
+        rendersContent = [(UIView *)layer.delegate methodForSelector:@selector(drawRect:)] != [UIView instanceMethodForSelector:@selector(drawRect:)];
+    }
+    
+    if (!rendersContent) {
+        return 0;
+    }
+    
+    const CGFloat scale = layer.contentsScale;
+    const CGSize size = layer.bounds.size;
+    
+    return (uint64_t)(ceil(size.width * scale) * ceil(size.height * scale)) * 4;
+};
+
+static void MMSplitAccumulateLayerTree(CALayer *layer, NSSet <CALayer *> *excludedLayers, MMSplitLayerFootprint *footprint)
+{
+    if (layer == nil || [excludedLayers containsObject:layer]) {
+        return;
+    }
+    
+    footprint->layerCount += 1;
+    footprint->backingStoreBytes += MMSplitLayerBackingStoreBytes(layer);
+    
+    MMSplitAccumulateLayerTree(layer.mask, excludedLayers, footprint);
+    
+    for (CALayer *sublayer in layer.sublayers) {
+        MMSplitAccumulateLayerTree(sublayer, excludedLayers, footprint);
+    }
+}
+
+MMSplitLayerFootprint MMSplitLayerFootprintForLayerTree(CALayer *layer, NSSet <CALayer *> *excludedLayers)
+{
+    MMSplitLayerFootprint footprint = { 0 };
+    
+    MMSplitAccumulateLayerTree(layer, excludedLayers, &footprint);
+    
+    return footprint;
+}
+
+static void MMSplitCollectSupplementaryViews(UIView *view, NSMutableArray <UIView *> *headerViews, NSMutableArray <UIView *> *footerViews)
+{
+    for (UIView *subview in view.subviews) {
+        if ([subview isKindOfClass:[MMSnapHeaderView class]]) {
+            [headerViews addObject:subview];
+        } else if ([subview isKindOfClass:[MMSnapFooterView class]]) {
+            [footerViews addObject:subview];
+        } else {
+            MMSplitCollectSupplementaryViews(subview, headerViews, footerViews);
+        }
+    }
+}
+
+@implementation MMSplitPaneFootprint
+
++ (instancetype)footprintForViewController:(UIViewController *)viewController paneView:(UIView *)paneView
+{
+    MMSplitPaneFootprint *footprint = [[self alloc] init];
+    footprint.viewController = viewController;
+    footprint.viewLoaded = viewController.isViewLoaded;
+    
+    // Don't load views just to measure them:
+    UIView *view = viewController.isViewLoaded ? viewController.view : nil;
+    
+    if (view != nil) {
+        NSMutableArray <UIView *> *headerViews = [NSMutableArray array];
+        NSMutableArray <UIView *> *footerViews = [NSMutableArray array];
+        
+        MMSplitCollectSupplementaryViews(view, headerViews, footerViews);
+        
+        NSMutableSet <CALayer *> *supplementaryLayers = [NSMutableSet setWithCapacity:headerViews.count + footerViews.count];
+        MMSplitLayerFootprint headerFootprint = { 0 };
+        MMSplitLayerFootprint footerFootprint = { 0 };
+        
+        for (UIView *headerView in headerViews) {
+            headerFootprint = MMSplitLayerFootprintAdd(headerFootprint, MMSplitLayerFootprintForLayerTree(headerView.layer, nil));
+            [supplementaryLayers addObject:headerView.layer];
+        }
+        
+        for (UIView *footerView in footerViews) {
+            footerFootprint = MMSplitLayerFootprintAdd(footerFootprint, MMSplitLayerFootprintForLayerTree(footerView.layer, nil));
+            [supplementaryLayers addObject:footerView.layer];
+        }
+        
+        footprint.headerFootprint = headerFootprint;
+        footprint.footerFootprint = footerFootprint;
+        footprint.contentFootprint = MMSplitLayerFootprintForLayerTree(view.layer, supplementaryLayers);
+        footprint.attached = (paneView.superview != nil && [view isDescendantOfView:paneView]);
+    }
+    
+    if (paneView != nil) {
+        // Everything in the pane but its content is chrome:
+        UIView *contentView = [paneView isKindOfClass:[MMSplitPaneView class]] ? [(MMSplitPaneView *)paneView contentView] : nil;
+        NSSet <CALayer *> *contentLayers = contentView ? [NSSet setWithObject:contentView.layer] : nil;
+        
+        footprint.chromeFootprint = MMSplitLayerFootprintForLayerTree(paneView.layer, contentLayers);
+    }
+    
+    return footprint;
+}
+
+- (MMSplitLayerFootprint)totalFootprint
+{
+    MMSplitLayerFootprint footprint = self.contentFootprint;
+    footprint = MMSplitLayerFootprintAdd(footprint, self.headerFootprint);
+    footprint = MMSplitLayerFootprintAdd(footprint, self.footerFootprint);
+    footprint = MMSplitLayerFootprintAdd(footprint, self.chromeFootprint);
+    
+    return footprint;
+}
+
+@end
+
+@implementation MMSplitFootprint
+
+- (instancetype)init
+{
+    self = [super init];
+    if (self) {
+        _paneFootprints = @[];
+    }
+    return self;
+}
+
+- (MMSplitLayerFootprint)chromeFootprint
+{
+    MMSplitLayerFootprint footprint = self.splitFootprint;
+    
+    for (MMSplitPaneFootprint *paneFootprint in self.paneFootprints) {
+        footprint = MMSplitLayerFootprintAdd(footprint, paneFootprint.chromeFootprint);
+    }
+    
+    return footprint;
+}
+
+- (MMSplitLayerFootprint)supplementaryFootprint
+{
+    MMSplitLayerFootprint footprint = { 0 };
+    
+    for (MMSplitPaneFootprint *paneFootprint in self.paneFootprints) {
+        footprint = MMSplitLayerFootprintAdd(footprint, paneFootprint.headerFootprint);
+        footprint = MMSplitLayerFootprintAdd(footprint, paneFootprint.footerFootprint);
+    }
+    
+    return footprint;
+}
+
+- (MMSplitLayerFootprint)totalFootprint
+{
+    MMSplitLayerFootprint footprint = self.splitFootprint;
+    
+    for (MMSplitPaneFootprint *paneFootprint in self.paneFootprints) {
+        footprint = MMSplitLayerFootprintAdd(footprint, paneFootprint.totalFootprint);
+    }
+    
+    return footprint;
+}
+
+@end
@@ -0,0 +1,77 @@
+//
+//  MMSplitLayoutSnapshot.h
+//  MMSplitViewController
+//
+//  Created by Matías Martínez on 3/4/19.
+//  Copyright © 2019 Matías. All rights reserved.
+//
+
+#import <Foundation/Foundation.h>
+#import <CoreGraphics/CoreGraphics.h>
+
+NS_ASSUME_NONNULL_BEGIN
+
+/**
+ *  The current version of the binary representation produced by @c MMSplitLayoutSnapshot.
+ */
+extern const uint16_t MMSplitLayoutSnapshotVersion;
+
+/**
+ *  An object that holds the resolved layout of a split view controller, and converts it to and from a compact binary representation.
+ *
+ *  The binary representation is little-endian with fixed-width fields, so it can be written on one platform and read on another.
+ */
+@interface MMSplitLayoutSnapshot : NSObject
+
+/**
+ *  Returns a snapshot decoded from the specified data, or @c nil if the data is malformed or was written by an unsupported version.
+ *
+ *  @param data The binary representation of a snapshot.
+ *
+ *  @return A snapshot instance or @c nil.
+ */
+- (nullable instancetype)initWithData:(NSData *)data;
+
+/**
+ *  The binary representation of the receiver.
+ */
+@property (readonly, nonatomic) NSData *dataRepresentation;
+
+/**
+ *  The raw value of the display mode the layout was resolved for.
+ */
+@property (assign, nonatomic) NSUInteger displayMode;
+
+/**
+ *  The bounds size the layout was resolved for.
+ */
+@property (assign, nonatomic) CGSize boundsSize;
+
+/**
+ *  The content offset of the split view.
+ */
+@property (assign, nonatomic) CGPoint contentOffset;
+
+/**
+ *  The index of the snapped pane, or @c NSNotFound.
+ */
+@property (assign, nonatomic) NSUInteger snappedIndex;
+
+/**
+ *  The number of primary columns grouped together in a single collapsed column.
+ */
+@property (assign, nonatomic) NSUInteger primaryCollapsedCount;
+
+/**
+ *  The raw column size values, one for each child view controller.
+ */
+@property (copy, nonatomic) NSArray <NSNumber *> *columnSizes;
+
+/**
+ *  The resolved widths of the panes in the split view.
+ */
+@property (copy, nonatomic) NSArray <NSNumber *> *paneWidths;
+
+@end
+
+NS_ASSUME_NONNULL_END
@@ -0,0 +1,111 @@
+//
+//  MMSplitLayoutSnapshot.m
+//  MMSplitViewController
+//
+//  Created by Matías Martínez on 3/4/19.
+//  Copyright © 2019 Matías. All rights reserved.
+//
+
+#import "MMSplitLayoutSnapshot.h"
+#import "MMSplitLayoutSnapshotCodec.h"
+
+const uint16_t MMSplitLayoutSnapshotVersion = MMSplitLayoutSnapshotCodecVersion;
+
+@implementation MMSplitLayoutSnapshot
+
+- (instancetype)init
+{
+    self = [super init];
+    if (self) {
+        _snappedIndex = NSNotFound;
+        _columnSizes = @[];
+        _paneWidths = @[];
+    }
+    return self;
+}
+
+- (instancetype)initWithData:(NSData *)data
+{
+    self = [self init];
+    if (self) {
+        MMSplitLayoutSnapshotHeader header;
+        
+        if (!MMSplitLayoutSnapshotDecodeHeader(data.bytes, data.length, &header)) {
+            return nil;
+        }
+        
+        // The header guarantees the counts fit in the data:
+        NSMutableData *columnSizeBuffer = [NSMutableData dataWithLength:header.columnCount];
+        NSMutableData *paneWidthBuffer = [NSMutableData dataWithLength:header.paneCount * sizeof(float)];
+        
+        if (!MMSplitLayoutSnapshotDecodeBody(data.bytes, data.length, &header, columnSizeBuffer.mutableBytes, paneWidthBuffer.mutableBytes)) {
+            return nil;
+        }
+        
+        const uint8_t *rawColumnSizes = columnSizeBuffer.bytes;
+        const float *rawPaneWidths = paneWidthBuffer.bytes;
+        
+        NSMutableArray <NSNumber *> *columnSizes = [NSMutableArray arrayWithCapacity:header.columnCount];
+        
+        for (uint32_t idx = 0; idx < header.columnCount; idx++) {
+            [columnSizes addObject:@(rawColumnSizes[idx])];
+        }
+        
+        NSMutableArray <NSNumber *> *paneWidths = [NSMutableArray arrayWithCapacity:header.paneCount];
+        
+        for (uint32_t idx = 0; idx < header.paneCount; idx++) {
+            [paneWidths addObject:@((CGFloat)rawPaneWidths[idx])];
+        }
+        
+        _displayMode = header.displayMode;
+        _boundsSize = (CGSize){ header.boundsWidth, header.boundsHeight };
+        _contentOffset = (CGPoint){ header.contentOffsetX, header.contentOffsetY };
+        _snappedIndex = (header.snappedIndex == MMSplitLayoutSnapshotCodecNotFound) ? NSNotFound : header.snappedIndex;
+        _primaryCollapsedCount = header.primaryCollapsedCount;
+        _columnSizes = columnSizes.copy;
+        _paneWidths = paneWidths.copy;
+    }
+    return self;
+}
+
+- (NSData *)dataRepresentation
+{
+    NSArray <NSNumber *> *columnSizes = self.columnSizes;
+    NSArray <NSNumber *> *paneWidths = self.paneWidths;
+    
+    const NSUInteger snappedIndex = self.snappedIndex;
+    
+    const MMSplitLayoutSnapshotHeader header = (MMSplitLayoutSnapshotHeader){
+        .displayMode = (uint8_t)self.displayMode,
+        .boundsWidth = (float)self.boundsSize.width,
+        .boundsHeight = (float)self.boundsSize.height,
+        .contentOffsetX = (float)self.contentOffset.x,
+        .contentOffsetY = (float)self.contentOffset.y,
+        .snappedIndex = (snappedIndex < MMSplitLayoutSnapshotCodecNotFound) ? (uint32_t)snappedIndex : MMSplitLayoutSnapshotCodecNotFound,
+        .primaryCollapsedCount = (uint32_t)self.primaryCollapsedCount,
+        .columnCount = (uint32_t)columnSizes.count,
+        .paneCount = (uint32_t)paneWidths.count
+    };
+    
+    NSMutableData *columnSizeBuffer = [NSMutableData dataWithLength:header.columnCount];
+    NSMutableData *paneWidthBuffer = [NSMutableData dataWithLength:header.paneCount * sizeof(float)];
+    
+    uint8_t *rawColumnSizes = columnSizeBuffer.mutableBytes;
+    float *rawPaneWidths = paneWidthBuffer.mutableBytes;
+    
+    [columnSizes enumerateObjectsUsingBlock:^(NSNumber *columnSize, NSUInteger idx, BOOL *stop) {
+        rawColumnSizes[idx] = (uint8_t)columnSize.unsignedIntegerValue;
+    }];
+    
+    [paneWidths enumerateObjectsUsingBlock:^(NSNumber *width, NSUInteger idx, BOOL *stop) {
+        rawPaneWidths[idx] = (float)width.doubleValue;
+    }];
+    
+    NSMutableData *data = [NSMutableData dataWithLength:(NSUInteger)MMSplitLayoutSnapshotEncodedLength(&header)];
+    
+    MMSplitLayoutSnapshotEncode(&header, rawColumnSizes, rawPaneWidths, data.mutableBytes);
+    
+    return data.copy;
+}
+
+@end
@@ -0,0 +1,151 @@
+//
+//  MMSplitLayoutSnapshotCodec.c
+//  MMSplitViewController
+//
+//  Created by Matías Martínez on 3/13/19.
+//  Copyright © 2019 Matías. All rights reserved.
+//
+
+#include "MMSplitLayoutSnapshotCodec.h"
+#include <math.h>
+#include <string.h>
+
+static const uint32_t MMSplitLayoutSnapshotMagic = 0x4C534D4D; // "MMSL"
+
+// MARK: - Writing.
+
+static inline uint8_t *MMSplitLayoutSnapshotWriteUInt8(uint8_t *bytes, uint8_t value){
+    bytes[0] = value;
+    return bytes + 1;
+};
+
+static inline uint8_t *MMSplitLayoutSnapshotWriteUInt16(uint8_t *bytes, uint16_t value){
+    bytes[0] = (uint8_t)(value & 0xFF);
+    bytes[1] = (uint8_t)(value >> 8);
+    return bytes + 2;
+};
+
+static inline uint8_t *MMSplitLayoutSnapshotWriteUInt32(uint8_t *bytes, uint32_t value){
+    bytes[0] = (uint8_t)(value & 0xFF);
+    bytes[1] = (uint8_t)(value >> 8);
+    bytes[2] = (uint8_t)(value >> 16);
+    bytes[3] = (uint8_t)(value >> 24);
+    return bytes + 4;
+};
+
+static inline uint8_t *MMSplitLayoutSnapshotWriteFloat32(uint8_t *bytes, float value){
+    uint32_t bits;
+    memcpy(&bits, &value, sizeof(bits));
+    return MMSplitLayoutSnapshotWriteUInt32(bytes, bits);
+};
+
+// MARK: - Reading.
+
+static inline uint16_t MMSplitLayoutSnapshotReadUInt16(const uint8_t *bytes){
+    return (uint16_t)(bytes[0] | (bytes[1] << 8));
+};
+
+static inline uint32_t MMSplitLayoutSnapshotReadUInt32(const uint8_t *bytes){
+    return (uint32_t)bytes[0] | ((uint32_t)bytes[1] << 8) | ((uint32_t)bytes[2] << 16) | ((uint32_t)bytes[3] << 24);
+};
+
+static inline float MMSplitLayoutSnapshotReadFloat32(const uint8_t *bytes){
+    const uint32_t bits = MMSplitLayoutSnapshotReadUInt32(bytes);
+    float value;
+    memcpy(&value, &bits, sizeof(value));
+    return value;
+};
+
+// MARK: - Codec.
+
+uint64_t MMSplitLayoutSnapshotEncodedLength(const MMSplitLayoutSnapshotHeader *header)
+{
+    return MMSplitLayoutSnapshotCodecHeaderLength + (uint64_t)header->columnCount + (uint64_t)header->paneCount * 4;
+}
+
+void MMSplitLayoutSnapshotEncode(const MMSplitLayoutSnapshotHeader *header, const uint8_t *columnSizes, const float *paneWidths, uint8_t *bytes)
+{
+    bytes = MMSplitLayoutSnapshotWriteUInt32(bytes, MMSplitLayoutSnapshotMagic);
+    bytes = MMSplitLayoutSnapshotWriteUInt16(bytes, MMSplitLayoutSnapshotCodecVersion);
+    bytes = MMSplitLayoutSnapshotWriteUInt8(bytes, header->displayMode);
+    bytes = MMSplitLayoutSnapshotWriteUInt8(bytes, 0);
+    bytes = MMSplitLayoutSnapshotWriteFloat32(bytes, header->boundsWidth);
+    bytes = MMSplitLayoutSnapshotWriteFloat32(bytes, header->boundsHeight);
+    bytes = MMSplitLayoutSnapshotWriteFloat32(bytes, header->contentOffsetX);
+    bytes = MMSplitLayoutSnapshotWriteFloat32(bytes, header->contentOffsetY);
+    bytes = MMSplitLayoutSnapshotWriteUInt32(bytes, header->snappedIndex);
+    bytes = MMSplitLayoutSnapshotWriteUInt32(bytes, header->primaryCollapsedCount);
+    bytes = MMSplitLayoutSnapshotWriteUInt32(bytes, header->columnCount);
+    bytes = MMSplitLayoutSnapshotWriteUInt32(bytes, header->paneCount);
+
+    for (uint32_t idx = 0; idx < header->columnCount; idx++) {
+        bytes = MMSplitLayoutSnapshotWriteUInt8(bytes, columnSizes[idx]);
+    }
+
+    for (uint32_t idx = 0; idx < header->paneCount; idx++) {
+        bytes = MMSplitLayoutSnapshotWriteFloat32(bytes, paneWidths[idx]);
+    }
+}
+
+bool MMSplitLayoutSnapshotDecodeHeader(const uint8_t *bytes, size_t length, MMSplitLayoutSnapshotHeader *header)
+{
+    if (bytes == NULL || length < MMSplitLayoutSnapshotCodecHeaderLength) {
+        return false;
+    }
+
+    if (MMSplitLayoutSnapshotReadUInt32(bytes) != MMSplitLayoutSnapshotMagic || MMSplitLayoutSnapshotReadUInt16(bytes + 4) != MMSplitLayoutSnapshotCodecVersion) {
+        return false;
+    }
+
+    MMSplitLayoutSnapshotHeader result = (MMSplitLayoutSnapshotHeader){
+        .displayMode = bytes[6],
+        .boundsWidth = MMSplitLayoutSnapshotReadFloat32(bytes + 8),
+        .boundsHeight = MMSplitLayoutSnapshotReadFloat32(bytes + 12),
+        .contentOffsetX = MMSplitLayoutSnapshotReadFloat32(bytes + 16),
+        .contentOffsetY = MMSplitLayoutSnapshotReadFloat32(bytes + 20),
+        .snappedIndex = MMSplitLayoutSnapshotReadUInt32(bytes + 24),
+        .primaryCollapsedCount = MMSplitLayoutSnapshotReadUInt32(bytes + 28),
+        .columnCount = MMSplitLayoutSnapshotReadUInt32(bytes + 32),
+        .paneCount = MMSplitLayoutSnapshotReadUInt32(bytes + 36)
+    };
+
+    if (!isfinite(result.boundsWidth) || !isfinite(result.boundsHeight) || !isfinite(result.contentOffsetX) || !isfinite(result.contentOffsetY)) {
+        return false;
+    }
+
+    // Reject counts that can't possibly fit in the data before anyone allocates for them:
+    if (MMSplitLayoutSnapshotEncodedLength(&result) != (uint64_t)length || result.primaryCollapsedCount > result.columnCount) {
+        return false;
+    }
+
+    *header = result;
+
+    return true;
+}
+
+bool MMSplitLayoutSnapshotDecodeBody(const uint8_t *bytes, size_t length, const MMSplitLayoutSnapshotHeader *header, uint8_t *columnSizes, float *paneWidths)
+{
+    if (MMSplitLayoutSnapshotEncodedLength(header) != (uint64_t)length) {
+        return false;
+    }
+
+    bytes += MMSplitLayoutSnapshotCodecHeaderLength;
+
+    if (header->columnCount > 0) {
+        memcpy(columnSizes, bytes, header->columnCount);
+        bytes += header->columnCount;
+    }
+
+    for (uint32_t idx = 0; idx < header->paneCount; idx++) {
+        const float width = MMSplitLayoutSnapshotReadFloat32(bytes);
+
+        if (!isfinite(width) || width < 0.0f) {
+            return false;
+        }
+
+        paneWidths[idx] = width;
+        bytes += 4;
+    }
+
+    return true;
+}
@@ -0,0 +1,88 @@
+//
+//  MMSplitLayoutSnapshotCodec.h
+//  MMSplitViewController
+//
+//  Created by Matías Martínez on 3/13/19.
+//  Copyright © 2019 Matías. All rights reserved.
+//
+
+#ifndef MMSplitLayoutSnapshotCodec_h
+#define MMSplitLayoutSnapshotCodec_h
+
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ *  The binary format of @c MMSplitLayoutSnapshot, in plain C so it can be built and tested on any platform.
+ *
+ *  The format is little-endian with fixed-width fields: a 40 byte header, one byte for each column size, and a 32-bit float for each pane width.
+ */
+enum {
+    MMSplitLayoutSnapshotCodecVersion = 1,
+    MMSplitLayoutSnapshotCodecHeaderLength = 40,
+};
+
+/**
+ *  The value stored for a snapped index that is not found.
+ */
+#define MMSplitLayoutSnapshotCodecNotFound UINT32_MAX
+
+/**
+ *  The fixed-width fields of a snapshot.
+ */
+typedef struct MMSplitLayoutSnapshotHeader {
+    uint8_t displayMode;
+    float boundsWidth;
+    float boundsHeight;
+    float contentOffsetX;
+    float contentOffsetY;
+    uint32_t snappedIndex;
+    uint32_t primaryCollapsedCount;
+    uint32_t columnCount;
+    uint32_t paneCount;
+} MMSplitLayoutSnapshotHeader;
+
+/**
+ *  Returns the number of bytes needed to encode a snapshot with the counts in @c header.
+ */
+uint64_t MMSplitLayoutSnapshotEncodedLength(const MMSplitLayoutSnapshotHeader *header);
+
+/**
+ *  Encodes a snapshot.
+ *
+ *  @param header      The fixed-width fields.
+ *  @param columnSizes @c header->columnCount raw column sizes.
+ *  @param paneWidths  @c header->paneCount pane widths.
+ *  @param bytes       A buffer of at least @c MMSplitLayoutSnapshotEncodedLength(header) bytes.
+ */
+void MMSplitLayoutSnapshotEncode(const MMSplitLayoutSnapshotHeader *header, const uint8_t *columnSizes, const float *paneWidths, uint8_t *bytes);
+
+/**
+ *  Decodes and validates the fixed-width fields of a snapshot.
+ *
+ *  Fails if the magic number or version don't match, if any float is not finite, or if the counts don't describe exactly @c length bytes. A successful result guarantees that @c MMSplitLayoutSnapshotDecodeBody() can read the counts in @c header.
+ *
+ *  @return @c true if the header is valid.
+ */
+bool MMSplitLayoutSnapshotDecodeHeader(const uint8_t *bytes, size_t length, MMSplitLayoutSnapshotHeader *header);
+
+/**
+ *  Decodes the column sizes and pane widths of a snapshot whose header was decoded by @c MMSplitLayoutSnapshotDecodeHeader().
+ *
+ *  @param columnSizes A buffer for @c header->columnCount column sizes.
+ *  @param paneWidths  A buffer for @c header->paneCount pane widths.
+ *
+ *  @return @c true if every pane width is finite and not negative.
+ */
+bool MMSplitLayoutSnapshotDecodeBody(const uint8_t *bytes, size_t length, const MMSplitLayoutSnapshotHeader *header, uint8_t *columnSizes, float *paneWidths);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* MMSplitLayoutSnapshotCodec_h */
@@ -0,0 +1,62 @@
+//
+//  MMSplitPaneChromeLayer.h
+//  MMSplitViewController
+//
+//  Created by Matías Martínez on 3/6/19.
+//  Copyright © 2019 Matías. All rights reserved.
+//
+
+#import <UIKit/UIKit.h>
+
+NS_ASSUME_NONNULL_BEGIN
+
+/**
+ *  The chrome state of a single pane, in the coordinate space of the split view.
+ */
+typedef struct {
+    /**
+     *  The frame of the pane.
+     */
+    CGRect frame;
+    
+    /**
+     *  The horizontal position at which the pane is covered by the next pane.
+     */
+    CGFloat visibleMaxX;
+    
+    /**
+     *  The relative progress of the hugging transition for the pane.
+     */
+    CGFloat huggingProgress;
+} MMSplitPaneChrome;
+
+/**
+ *  A layer that displays the separators, drop shadows and hugging overlays of many panes at once.
+ *
+ *  The layer keeps one small sublayer for each chrome state and only updates their frames and opacities, so it never draws on the CPU. Keep the layer at the origin of the split view, so chrome frames map directly onto it.
+ */
+@interface MMSplitPaneChromeLayer : CALayer
+
+/**
+ *  Determines if separators are drawn as drop shadows instead of single lines.
+ */
+@property (assign, nonatomic) BOOL drawsDropShadows;
+
+/**
+ *  The color of the separator lines.
+ */
+@property (strong, nonatomic) UIColor *separatorColor;
+
+/**
+ *  Replaces the chrome state drawn by the layer.
+ *
+ *  The layer only updates its sublayers if the state changed since the last call.
+ *
+ *  @param chromes A buffer of chrome states, ordered from back to front.
+ *  @param count   The number of chrome states in @c chromes.
+ */
+- (void)setChromes:(const MMSplitPaneChrome *)chromes count:(NSUInteger)count;
+
+@end
+
+NS_ASSUME_NONNULL_END
@@ -0,0 +1,189 @@
+//
+//  MMSplitPaneChromeLayer.m
+//  MMSplitViewController
+//
+//  Created by Matías Martínez on 3/6/19.
+//  Copyright © 2019 Matías. All rights reserved.
+//
+
+#import "MMSplitPaneChromeLayer.h"
+
+static const CGFloat MMSplitPaneChromeSeparatorWidth = 10.0f;
+static const CGFloat MMSplitPaneChromeOverlayAlpha = 0.1f;
+static const CGFloat MMSplitPaneChromeShadowAlpha = 0.25f;
+
+@interface _MMSplitPaneChromeSlotLayer : CALayer
+
+@property (strong, nonatomic) CALayer *overlayLayer;
+@property (strong, nonatomic) CALayer *separatorLayer;
+@property (strong, nonatomic) CAGradientLayer *shadowLayer;
+
+@end
+
+@implementation _MMSplitPaneChromeSlotLayer
+
+- (instancetype)init
+{
+    self = [super init];
+    if (self) {
+        self.masksToBounds = YES;
+        
+        _overlayLayer = [CALayer layer];
+        _overlayLayer.backgroundColor = [UIColor colorWithWhite:0.0f alpha:MMSplitPaneChromeOverlayAlpha].CGColor;
+        
+        _separatorLayer = [CALayer layer];
+        
+        _shadowLayer = [CAGradientLayer layer];
+        _shadowLayer.colors = @[ (id)[UIColor colorWithWhite:0.0f alpha:0.0f].CGColor, (id)[UIColor colorWithWhite:0.0f alpha:MMSplitPaneChromeShadowAlpha].CGColor ];
+        _shadowLayer.startPoint = CGPointMake(0.0f, 0.5f);
+        _shadowLayer.endPoint = CGPointMake(1.0f, 0.5f);
+        
+        [self addSublayer:_overlayLayer];
+        [self addSublayer:_separatorLayer];
+        [self addSublayer:_shadowLayer];
+    }
+    return self;
+}
+
+@end
+
+@interface MMSplitPaneChromeLayer ()
+
+@property (strong, nonatomic) NSMutableData *chromeData;
+@property (assign, nonatomic) NSUInteger chromeCount;
+@property (strong, nonatomic) NSMutableArray <_MMSplitPaneChromeSlotLayer *> *slotLayers;
+
+@end
+
+@implementation MMSplitPaneChromeLayer
+
+- (instancetype)init
+{
+    self = [super init];
+    if (self) {
+        _chromeData = [NSMutableData data];
+        _slotLayers = [NSMutableArray array];
+        _separatorColor = [UIColor colorWithWhite:0.0f alpha:0.25f];
+        
+        self.opaque = NO;
+    }
+    return self;
+}
+
+- (id<CAAction>)actionForKey:(NSString *)event
+{
+    // The chrome tracks the panes, never animate it on its own:
+    return (id <CAAction>)[NSNull null];
+}
+
+- (void)setChromes:(const MMSplitPaneChrome *)chromes count:(NSUInteger)count
+{
+    const NSUInteger length = count * sizeof(MMSplitPaneChrome);
+    
+    if (count == self.chromeCount && (length == 0 || memcmp(self.chromeData.bytes, chromes, length) == 0)) {
+        return;
+    }
+    
+    if (self.chromeData.length < length) {
+        self.chromeData.length = length;
+    }
+    
+    if (length > 0) {
+        [self.chromeData replaceBytesInRange:NSMakeRange(0, length) withBytes:chromes];
+    }
+    
+    self.chromeCount = count;
+    
+    [self layoutChromes];
+}
+
+- (void)setDrawsDropShadows:(BOOL)drawsDropShadows
+{
+    if (drawsDropShadows != _drawsDropShadows) {
+        _drawsDropShadows = drawsDropShadows;
+        
+        [self layoutChromes];
+    }
+}
+
+- (void)setSeparatorColor:(UIColor *)separatorColor
+{
+    if (![separatorColor isEqual:_separatorColor]) {
+        _separatorColor = separatorColor;
+        
+        [self layoutChromes];
+    }
+}
+
+- (void)layoutChromes
+{
+    const NSUInteger count = self.chromeCount;
+    const MMSplitPaneChrome *chromes = self.chromeData.bytes;
+    
+    const CGFloat scale = MAX(self.contentsScale, 1.0f);
+    const CGFloat hairlineWidth = 1.0f / scale;
+    const BOOL drawsDropShadows = self.drawsDropShadows;
+    
+    CGColorRef separatorColor = self.separatorColor.CGColor;
+    
+    // Only frames and opacities change, so the compositor does all the work:
+    [CATransaction begin];
+    [CATransaction setDisableActions:YES];
+    
+    NSMutableArray <_MMSplitPaneChromeSlotLayer *> *slotLayers = self.slotLayers;
+    
+    while (slotLayers.count < count) {
+        _MMSplitPaneChromeSlotLayer *slotLayer = [_MMSplitPaneChromeSlotLayer layer];
+        
+        [slotLayers addObject:slotLayer];
+        [self addSublayer:slotLayer];
+    }
+    
+    for (NSUInteger idx = 0; idx < slotLayers.count; idx++) {
+        _MMSplitPaneChromeSlotLayer *slotLayer = slotLayers[idx];
+        
+        if (idx >= count) {
+            slotLayer.hidden = YES;
+            continue;
+        }
+        
+        const MMSplitPaneChrome chrome = chromes[idx];
+        const CGRect frame = chrome.frame;
+        const CGFloat width = CGRectGetWidth(frame);
+        const CGFloat height = CGRectGetHeight(frame);
+        const CGFloat progress = chrome.huggingProgress;
+        
+        // Don't draw over the panes stacked above this one:
+        const CGRect clipRect = (CGRect){
+            .origin = frame.origin,
+            .size.width = MAX(MIN(chrome.visibleMaxX, CGRectGetMaxX(frame)) - CGRectGetMinX(frame), 0.0f),
+            .size.height = height
+        };
+        
+        slotLayer.hidden = CGRectIsEmpty(clipRect);
+        
+        if (slotLayer.isHidden) {
+            continue;
+        }
+        
+        slotLayer.frame = clipRect;
+        
+        // Hugging overlay, offset along with the pane's content:
+        slotLayer.overlayLayer.hidden = (progress <= 0.0f);
+        slotLayer.overlayLayer.frame = CGRectMake(progress * (width / 2.0f), 0.0f, width, height);
+        slotLayer.overlayLayer.opacity = progress;
+        
+        slotLayer.shadowLayer.hidden = !(drawsDropShadows && progress > 0.0f);
+        slotLayer.shadowLayer.frame = CGRectMake(width - MMSplitPaneChromeSeparatorWidth, 0.0f, MMSplitPaneChromeSeparatorWidth, height);
+        slotLayer.shadowLayer.opacity = progress;
+        
+        slotLayer.separatorLayer.hidden = (drawsDropShadows || progress >= 1.0f);
+        slotLayer.separatorLayer.frame = CGRectMake(width - hairlineWidth, 0.0f, hairlineWidth, height);
+        slotLayer.separatorLayer.opacity = 1.0f - progress;
+        slotLayer.separatorLayer.backgroundColor = separatorColor;
+    }
+    
+    [CATransaction commit];
+}
+
+@end
@@ -8,6 +8,7 @@
 
 #import <UIKit/UIKit.h>
 #import "MMSplitHuggingSupporting.h"
+#import "MMSplitReusePool.h"
 
 @class MMSplitSeparatorView;
 
@@ -16,7 +17,7 @@ NS_ASSUME_NONNULL_BEGIN
 /**
  *  A container view for panes in an split view that supports hugging transitions.
  */
-@interface MMSplitPaneView : UIView <MMSplitHuggingSupporting>
+@interface MMSplitPaneView : UIView <MMSplitHuggingSupporting, MMSplitReusableView>
 
 /**
  *  The main view to which you add your pane’s custom content.
@@ -30,6 +31,13 @@ NS_ASSUME_NONNULL_BEGIN
  */
 @property (nonatomic, strong, readonly) MMSplitSeparatorView *separatorView;
 
+/**
+ *  Determines if the pane view renders its own separator and hugging overlay.
+ *
+ *  The split view sets this property to @c NO when it renders the chrome of all its panes in a single shared layer. When the value of this property is @c NO, the pane view doesn't create a separator or overlay view until it is needed again. The default value of this property is @c YES.
+ */
+@property (nonatomic, assign) BOOL rendersChrome;
+
 @end
 
 NS_ASSUME_NONNULL_END
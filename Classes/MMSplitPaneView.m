@@ -43,23 +43,55 @@
         
         [self addSubview:containerView];
         
-        MMSplitSeparatorView *separatorView = [[MMSplitSeparatorView alloc] initWithFrame:CGRectZero];
-        
-        _separatorView = separatorView;
-        
-        [self addSubview:separatorView];
+        _rendersChrome = YES;
         
+        [self loadChromeIfNeeded];
+        [self configureForHugging];
+    }
+    return self;
+}
+
+- (void)loadChromeIfNeeded
+{
+    if (!self.rendersChrome) {
+        return;
+    }
+    
+    self.separatorView.hidden = NO;
+    
+    if (!self.overlayView) {
         UIView *overlayView = [[UIView alloc] initWithFrame:CGRectZero];
         overlayView.backgroundColor = [UIColor colorWithWhite:0.0f alpha:0.1f];
         overlayView.userInteractionEnabled = NO;
         
         self.overlayView = overlayView;
         
-        [containerView addSubview:overlayView];
+        [self.containerView addSubview:overlayView];
+    }
+}
+
+- (void)unloadChrome
+{
+    [_separatorView removeFromSuperview];
+    [_overlayView removeFromSuperview];
+    
+    _separatorView = nil;
+    _overlayView = nil;
+}
+
+- (MMSplitSeparatorView *)separatorView
+{
+    if (!_separatorView) {
+        MMSplitSeparatorView *separatorView = [[MMSplitSeparatorView alloc] initWithFrame:CGRectZero];
+        separatorView.style = self.isPagingEnabled ? MMSplitSeparatorStyleDropShadow : MMSplitSeparatorStyleSingleLine;
+        separatorView.shadowOpacity = self.huggingProgress;
+        separatorView.hidden = !self.rendersChrome;
         
-        [self configureForHugging];
+        _separatorView = separatorView;
+        
+        [self addSubview:separatorView];
     }
-    return self;
+    return _separatorView;
 }
 
 - (void)layout
@@ -76,20 +108,33 @@
         rect = CGRectOffset(rect, self.huggingProgress * maximumOffset, 0.0f);
     }
     
-    self.containerView.frame = rect;
-    self.overlayView.frame = bounds;
+    // Only touch frames that actually changed, so a hugging update doesn't
+    // invalidate the layout of a nested split view:
+    if (!CGRectEqualToRect(rect, self.containerView.frame)) {
+        self.containerView.frame = rect;
+    }
+    
+    if (!CGRectEqualToRect(bounds, self.overlayView.frame)) {
+        self.overlayView.frame = bounds;
+    }
     
     if (!CGRectEqualToRect(bounds, self.contentView.frame)) {
         self.contentView.frame = bounds;
     }
     
-    CGSize separatorSize = [self.separatorView sizeThatFits:rect.size];
-    CGRect separatorRect = (CGRect){
-        .origin.x = CGRectGetMaxX(self.bounds) - separatorSize.width,
-        .size = separatorSize
-    };
+    MMSplitSeparatorView *separatorView = _separatorView;
     
-    self.separatorView.frame = separatorRect;
+    if (separatorView != nil) {
+        CGSize separatorSize = [separatorView sizeThatFits:rect.size];
+        CGRect separatorRect = (CGRect){
+            .origin.x = CGRectGetMaxX(self.bounds) - separatorSize.width,
+            .size = separatorSize
+        };
+        
+        if (!CGRectEqualToRect(separatorRect, separatorView.frame)) {
+            separatorView.frame = separatorRect;
+        }
+    }
 }
 
 - (void)layoutSubviews
@@ -104,7 +149,22 @@
     
     self.overlayView.alpha = progress;
     self.overlayView.hidden = (progress == 0.0f);
-    self.separatorView.shadowOpacity = progress;
+    _separatorView.shadowOpacity = progress;
+}
+
+- (void)setRendersChrome:(BOOL)rendersChrome
+{
+    if (rendersChrome != _rendersChrome) {
+        _rendersChrome = rendersChrome;
+        
+        if (rendersChrome) {
+            [self loadChromeIfNeeded];
+            [self configureForHugging];
+            [self layout];
+        } else {
+            [self unloadChrome];
+        }
+    }
 }
 
 #pragma mark - Properties.
@@ -138,8 +198,23 @@
     if (_pagingEnabled != isPagingEnabled) {
         _pagingEnabled = isPagingEnabled;
         
-        self.separatorView.style = isPagingEnabled ? MMSplitSeparatorStyleDropShadow : MMSplitSeparatorStyleSingleLine;
+        _separatorView.style = isPagingEnabled ? MMSplitSeparatorStyleDropShadow : MMSplitSeparatorStyleSingleLine;
     }
 }
 
+#pragma mark <MMSplitReusableView>
+
+- (void)prepareForReuse
+{
+    // Drop the content of the previous owner, unless it already moved to another pane:
+    if (_contentView.superview != self.containerView) {
+        _contentView = nil;
+    }
+    
+    self.contentView = nil;
+    self.huggingProgress = 0.0f;
+    self.pagingEnabled = NO;
+    self.rendersChrome = YES;
+}
+
 @end
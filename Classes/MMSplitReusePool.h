@@ -0,0 +1,83 @@
+//
+//  MMSplitReusePool.h
+//  MMSplitViewController
+//
+//  Created by Matías Martínez on 3/13/19.
+//  Copyright © 2019 Matías. All rights reserved.
+//
+
+#import <UIKit/UIKit.h>
+
+NS_ASSUME_NONNULL_BEGIN
+
+/**
+ *  The @c MMSplitReusableView protocol is adopted by views that can be recycled through a @c MMSplitReusePool.
+ */
+@protocol MMSplitReusableView <NSObject>
+
+/**
+ *  Resets the view to the state of a newly created instance.
+ *
+ *  The pool calls this method when the view enters the pool, so pooled views don't hold on to the content of their previous owner.
+ */
+- (void)prepareForReuse;
+
+@end
+
+/**
+ *  A process-wide pool of pane chrome and supplementary bars, shared by all split view controllers.
+ *
+ *  Views are pooled by class, up to @c maximumViewCountPerClass views for each class. The pool empties itself when the application receives a memory warning.
+ *
+ *  @note The pool must only be used from the main thread.
+ */
+@interface MMSplitReusePool : NSObject
+
+/**
+ *  Returns the shared reuse pool.
+ */
++ (instancetype)sharedPool;
+
+/**
+ *  The maximum number of pooled views of each class. The default value is @c 8.
+ *
+ *  @note Lowering this value trims views already in the pool.
+ */
+@property (assign, nonatomic) NSUInteger maximumViewCountPerClass;
+
+/**
+ *  Returns a pooled view of the exact class specified, or @c nil if the pool has none.
+ *
+ *  @param viewClass The class of the view.
+ *
+ *  @return A view ready to be configured, or @c nil.
+ */
+- (nullable __kindof UIView *)dequeueViewOfClass:(Class)viewClass;
+
+/**
+ *  Adds a view to the pool.
+ *
+ *  The view is ignored if it is still in a view hierarchy, or if the pool is full for its class.
+ *
+ *  @param view The view to recycle.
+ */
+- (void)recycleView:(UIView <MMSplitReusableView> *)view;
+
+/**
+ *  Adds a view to the pool once the specified object deallocates.
+ *
+ *  Use this method for views that others may still reference while the object is alive, like a header view kept by its view controller. The object keeps the view until it deallocates, then the view is recycled on the main queue.
+ *
+ *  @param view   The view to recycle.
+ *  @param object The object the view belongs to. The pool doesn't retain this object.
+ */
+- (void)recycleView:(UIView <MMSplitReusableView> *)view whenObjectDeallocates:(id)object;
+
+/**
+ *  Removes all views from the pool.
+ */
+- (void)removeAllViews;
+
+@end
+
+NS_ASSUME_NONNULL_END
@@ -0,0 +1,165 @@
+//
+//  MMSplitReusePool.m
+//  MMSplitViewController
+//
+//  Created by Matías Martínez on 3/13/19.
+//  Copyright © 2019 Matías. All rights reserved.
+//
+
+#import "MMSplitReusePool.h"
+#import <objc/runtime.h>
+
+@interface _MMSplitReusePoolPendingView : NSObject
+
+@property (weak, nonatomic) MMSplitReusePool *pool;
+@property (strong, nonatomic) UIView <MMSplitReusableView> *view;
+
+@end
+
+@implementation _MMSplitReusePoolPendingView
+
+- (void)dealloc
+{
+    // Released with the object it is attached to, which may happen on any thread:
+    MMSplitReusePool *pool = _pool;
+    UIView <MMSplitReusableView> *view = _view;
+    
+    if (pool == nil || view == nil) {
+        return;
+    }
+    
+    dispatch_async(dispatch_get_main_queue(), ^{
+        [pool recycleView:view];
+    });
+}
+
+@end
+
+@interface MMSplitReusePool ()
+
+@property (strong, nonatomic) NSMutableDictionary <NSString *, NSMutableArray <UIView *> *> *views;
+
+@end
+
+static const NSUInteger MMSplitReusePoolDefaultMaximumViewCountPerClass = 8;
+
+@implementation MMSplitReusePool
+
++ (instancetype)sharedPool
+{
+    static MMSplitReusePool *sharedPool;
+    static dispatch_once_t onceToken;
+    dispatch_once(&onceToken, ^{
+        sharedPool = [[MMSplitReusePool alloc] init];
+    });
+    return sharedPool;
+}
+
+- (instancetype)init
+{
+    self = [super init];
+    if (self) {
+        _maximumViewCountPerClass = MMSplitReusePoolDefaultMaximumViewCountPerClass;
+        _views = [NSMutableDictionary dictionary];
+        
+        [[NSNotificationCenter defaultCenter] addObserver:self selector:@selector(_didReceiveMemoryWarning:) name:UIApplicationDidReceiveMemoryWarningNotification object:nil];
+    }
+    return self;
+}
+
+- (void)dealloc
+{
+    [[NSNotificationCenter defaultCenter] removeObserver:self];
+}
+
+- (void)_didReceiveMemoryWarning:(NSNotification *)notification
+{
+    [self removeAllViews];
+}
+
+#pragma mark - Pooling.
+
+- (void)setMaximumViewCountPerClass:(NSUInteger)maximumViewCountPerClass
+{
+    NSAssert([NSThread isMainThread], @"The reuse pool must only be used from the main thread.");
+    
+    _maximumViewCountPerClass = maximumViewCountPerClass;
+    
+    for (NSMutableArray <UIView *> *views in self.views.allValues) {
+        if (views.count > maximumViewCountPerClass) {
+            [views removeObjectsInRange:NSMakeRange(maximumViewCountPerClass, views.count - maximumViewCountPerClass)];
+        }
+    }
+}
+
+- (__kindof UIView *)dequeueViewOfClass:(Class)viewClass
+{
+    NSAssert([NSThread isMainThread], @"The reuse pool must only be used from the main thread.");
+    
+    NSMutableArray <UIView *> *views = self.views[NSStringFromClass(viewClass)];
+    UIView *view = views.lastObject;
+    
+    if (view) {
+        [views removeLastObject];
+    }
+    
+    return view;
+}
+
+- (void)recycleView:(UIView <MMSplitReusableView> *)view
+{
+    NSAssert([NSThread isMainThread], @"The reuse pool must only be used from the main thread.");
+    NSParameterAssert(view);
+    
+    // A view still in a hierarchy has an owner we don't know about:
+    if (view.superview != nil) {
+        return;
+    }
+    
+    NSString *key = NSStringFromClass(view.class);
+    NSMutableArray <UIView *> *views = self.views[key];
+    
+    if (views.count >= self.maximumViewCountPerClass) {
+        return;
+    }
+    
+    if (!views) {
+        views = [NSMutableArray array];
+        self.views[key] = views;
+    }
+    
+    if ([views indexOfObjectIdenticalTo:view] != NSNotFound) {
+        return;
+    }
+    
+    [view prepareForReuse];
+    [views addObject:view];
+}
+
+- (void)recycleView:(UIView <MMSplitReusableView> *)view whenObjectDeallocates:(id)object
+{
+    NSAssert([NSThread isMainThread], @"The reuse pool must only be used from the main thread.");
+    NSParameterAssert(view);
+    
+    if (!object) {
+        [self recycleView:view];
+        return;
+    }
+    
+    // The object owns the pending view, so the view is handed back as soon as the object goes away:
+    _MMSplitReusePoolPendingView *pendingView = [[_MMSplitReusePoolPendingView alloc] init];
+    pendingView.pool = self;
+    pendingView.view = view;
+    
+    objc_setAssociatedObject(object, (__bridge const void *)pendingView, pendingView, OBJC_ASSOCIATION_RETAIN_NONATOMIC);
+}
+
+- (void)removeAllViews
+{
+    NSAssert([NSThread isMainThread], @"The reuse pool must only be used from the main thread.");
+    
+    // Pending views are owned by their objects until those go away:
+    [self.views removeAllObjects];
+}
+
+@end
@@ -36,6 +36,17 @@ NS_ASSUME_NONNULL_BEGIN
  */
 - (void)scrollView:(MMSplitScrollView *)scrollView didEndDisplayingView:(UIView *)view atPage:(NSInteger)page;
 
+/**
+ *  Tells the delegate the pages displayed by the scroll view changed, in a single batch.
+ *
+ *  @param scrollView    The scroll view.
+ *  @param removedPages  The pages that ended being displayed.
+ *  @param insertedPages The pages about to be displayed.
+ *
+ *  @note When implemented, the scroll view calls this method once per change instead of @c -scrollView:willDisplayView:atPage: and @c -scrollView:didEndDisplayingView:atPage: for each view. Pages locate views in the current @c panes of @c scrollView.
+ */
+- (void)scrollView:(MMSplitScrollView *)scrollView didEndDisplayingPages:(NSIndexSet *)removedPages willDisplayPages:(NSIndexSet *)insertedPages;
+
 /**
  *  Tells the delegate the scroll view is about to snap to a view for a particular page.
  *
@@ -63,6 +74,17 @@ NS_ASSUME_NONNULL_BEGIN
  */
 - (CGSize)scrollView:(MMSplitScrollView *)scrollView sizeForView:(UIView *)view atPage:(NSInteger)page;
 
+/**
+ *  Asks the delegate for the widths of all the panes in a single pass.
+ *
+ *  @param scrollView The scroll view.
+ *  @param widths     A buffer to fill with the width of each pane.
+ *  @param count      The number of panes, and the capacity of @c widths.
+ *
+ *  @return @c YES if the delegate filled the buffer, or @c NO to have the scroll view ask for each pane using @c -scrollView:sizeForView:atPage:.
+ */
+- (BOOL)scrollView:(MMSplitScrollView *)scrollView getWidths:(CGFloat *)widths count:(NSUInteger)count;
+
 @end
 
 /**
@@ -82,6 +104,13 @@ NS_ASSUME_NONNULL_BEGIN
  */
 @property (copy, nonatomic, readonly) NSIndexSet *indexesForVisiblePanes;
 
+/**
+ *  The range of indexes for the visible panes in the split view.
+ *
+ *  Visible panes are always contiguous, so this property describes the same panes as @c indexesForVisiblePanes without creating an index set. If there are no visible panes, the length of the range is zero.
+ */
+@property (assign, nonatomic, readonly) NSRange rangeForVisiblePanes;
+
 /**
  *  The object that acts as the delegate of the split view.
  *
@@ -103,11 +132,40 @@ NS_ASSUME_NONNULL_BEGIN
  */
 @property (assign, nonatomic) BOOL overlayScreenCornersWhenBouncing;
 
+/**
+ *  Determines if the scroll view draws the separators, drop shadows and hugging overlays of all visible panes in a single shared layer.
+ *
+ *  When the value of this property is @c YES, the panes don't create their own separator and overlay views, so the number of layers doesn't grow with the number of panes. The default value of this property is @c NO.
+ */
+@property (assign, nonatomic) BOOL usesSharedChromeRenderer;
+
+/**
+ *  The bounds size the split view is using to resolve the size of its panes.
+ *
+ *  Outside of a size transition this is the current bounds size. While the split view resolves the destination layout of a size transition, this is the destination size. Delegates should use this value instead of the current bounds when implementing @c -scrollView:sizeForView:atPage:.
+ */
+@property (readonly, nonatomic) CGSize sizingBoundsSize;
+
+/**
+ *  The index of the pane the split view last snapped to, or @c NSNotFound if it hasn't snapped yet.
+ */
+@property (readonly, nonatomic) NSInteger snappedPaneIndex;
+
 /**
  *  Invalidates the current pane sizes and triggers a layout update.
  */
 - (void)invalidatePaneSizes;
 
+/**
+ *  Prepares the split view for a change in its bounds size.
+ *
+ *  The split view resolves the destination pane frames and content offset up front, and installs them inside the coordinator's animation so panes animate along with the bounds. Layout passes during the transition don't query the delegate for pane sizes.
+ *
+ *  @param size        The new size for the split view.
+ *  @param coordinator The transition coordinator object managing the size change.
+ */
+- (void)transitionToSize:(CGSize)size withTransitionCoordinator:(id <UIViewControllerTransitionCoordinator>)coordinator;
+
 /**
  *  Scrolls through the split view until a pane is snapped at the left side of the screen.
  *
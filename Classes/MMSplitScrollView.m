@@ -12,31 +12,77 @@
 #import "MMSpringScrollAnimator.h"
 #import "MMSplitHuggingSupporting.h"
 #import "MMRoundedCornerOverlayView.h"
+#import "MMSplitPaneChromeLayer.h"
+
+@interface _MMSplitScrollViewSizeTransition : NSObject
+
+@property (assign, nonatomic) CGSize destinationSize;
+@property (assign, nonatomic) CGSize destinationContentSize;
+@property (assign, nonatomic) CGPoint destinationContentOffset;
+@property (copy, nonatomic) NSArray <NSValue *> *destinationFrames;
+@property (assign, nonatomic) CGFloat destinationUniformPaneWidth;
+
+@property (assign, nonatomic, getter=isCommitted) BOOL committed;
+
+@end
+
+typedef NS_ENUM(NSUInteger, MMSplitSnapState) {
+    MMSplitSnapStateIdle,
+    MMSplitSnapStateTargeting,
+    MMSplitSnapStateSettling,
+    MMSplitSnapStateSnapped,
+};
 
 @interface MMSplitScrollView () <UIScrollViewDelegate, UIGestureRecognizerDelegate> {
     struct {
         unsigned int delegateWillDisplayView : 1;
         unsigned int delegateDidEndDisplayingView : 1;
+        unsigned int delegateDisplayPages : 1;
         unsigned int delegateWillSnapToPage : 1;
         unsigned int delegateDidSnapToPage : 1;
         unsigned int delegateSizeForPage : 1;
+        unsigned int delegateGetWidths : 1;
     } _delegateFlags;
 }
 
 @property (strong, nonatomic) NSArray <NSValue *> *framesForPanes;
+@property (assign, nonatomic) CGFloat uniformPaneWidth;
 @property (assign, nonatomic) CGSize calculatedBoundsSize;
 @property (assign, nonatomic, getter=isContentSizeInvalidated) BOOL contentSizeInvalidated;
-@property (assign, nonatomic) NSInteger snappedPaneIndex;
-@property (strong, nonatomic) NSMutableSet <UIView *> *visiblePanes;
+@property (assign, nonatomic, readwrite) NSInteger snappedPaneIndex;
+@property (assign, nonatomic) MMSplitSnapState snapState;
+@property (assign, nonatomic) NSUInteger snapTargetIndex;
+@property (assign, nonatomic) CGPoint trackedVelocity;
+@property (assign, nonatomic) CGPoint trackedContentOffset;
+@property (assign, nonatomic) CFTimeInterval trackedTimestamp;
+@property (readonly, nonatomic) CGPoint currentVelocity;
+@property (assign, nonatomic) CGPoint handoffVelocity;
+@property (assign, nonatomic) CFTimeInterval handoffTimestamp;
+@property (assign, nonatomic, readwrite) NSRange rangeForVisiblePanes;
+@property (strong, nonatomic) NSMapTable <UIView *, NSNumber *> *indexesForPanes;
 @property (strong, nonatomic) MMSpringScrollAnimator *scrollAnimator;
 @property (strong, nonatomic) MMRoundedCornerOverlayView *bounceCornersOverlayView;
 @property (strong, nonatomic) UIView *bounceElasticBackgroundView;
+@property (strong, nonatomic) _MMSplitScrollViewSizeTransition *sizeTransition;
+@property (assign, nonatomic, readwrite) CGSize sizingBoundsSize;
+@property (assign, nonatomic, getter=isLayoutInvalidated) BOOL layoutInvalidated;
+@property (assign, nonatomic) CGRect layoutVisibleRect;
+@property (weak, nonatomic) UIView *pinnablePane;
+@property (strong, nonatomic) MMSplitPaneChromeLayer *chromeLayer;
+@property (strong, nonatomic) NSMutableData *chromeBuffer;
 
 @property (strong, nonatomic) MMInvocationForwarder *delegateForwarder;
 @property (weak, nonatomic) id <MMSplitScrollViewDelegate> clientDelegate;
 
 @end
 
+// Velocity samples further apart than this are stale, closer than this come from the same frame:
+static const CFTimeInterval MMSplitVelocityMaximumSampleInterval = 0.1;
+static const CFTimeInterval MMSplitVelocityMinimumSampleInterval = 0.004;
+
+// How long a touch that interrupted the motion of the content can last and still carry it on:
+static const CFTimeInterval MMSplitHandoffInterval = 0.25;
+
 @implementation MMSplitScrollView
 
 @dynamic delegate;
@@ -62,9 +108,14 @@
 - (void)_commonInit
 {
     self.contentSizeInvalidated = YES;
+    self.layoutInvalidated = YES;
+    self.layoutVisibleRect = CGRectNull;
     self.calculatedBoundsSize = CGSizeZero;
-    self.visiblePanes = [NSMutableSet set];
+    self.rangeForVisiblePanes = NSMakeRange(0, 0);
+    self.indexesForPanes = [NSMapTable strongToStrongObjectsMapTable];
     self.snappedPaneIndex = NSNotFound;
+    self.snapState = MMSplitSnapStateIdle;
+    self.snapTargetIndex = NSNotFound;
     
     // Tap to snap gesture:
     UITapGestureRecognizer *snapGestureRecognizer = [[UITapGestureRecognizer alloc] initWithTarget:self action:@selector(snapTapGestureRecognized:)];
@@ -111,109 +162,246 @@
     
     animated = animated && [UIView areAnimationsEnabled];
     
-    if ([self.panes containsObject:pane]) {
-        const CGRect frame = [self rectForPane:pane];
+    if ([self indexOfPane:pane] != NSNotFound) {
+        CGPoint contentOffset = [self _contentOffsetForPane:pane];
         
-        CGRect bounds = self.bounds;
-        CGSize contentSize = self.contentSize;
-        
-        CGFloat maximumContentOffsetX = contentSize.width - CGRectGetWidth(bounds);
-        CGPoint contentOffset = CGPointMake(MIN(maximumContentOffsetX, frame.origin.x), 0);
+        // Already on the way there, don't restart the animation or notify again:
+        if (animated && self.scrollAnimator.isAnimating && CGPointEqualToPoint(contentOffset, self.scrollAnimator.destinationContentOffset)) {
+            return;
+        }
         
         if (!CGPointEqualToPoint(contentOffset, self.contentOffset)) {
-            if (_delegateFlags.delegateWillSnapToPage) {
-                [self _notifySnapToTargetContentOffset:contentOffset completed:NO];
+            // Carry the current motion into the spring, whether it comes from a fling, a drag or another spring:
+            CGPoint velocity = CGPointZero;
+            if (animated) {
+                if (self.isDecelerating || self.isTracking) {
+                    velocity = self.currentVelocity;
+                } else if (CACurrentMediaTime() - self.trackedTimestamp < MMSplitHandoffInterval) {
+                    // The content was stopped by the touch that got here, like a tap during a fling:
+                    velocity = self.trackedVelocity;
+                }
             }
             
+            // Take over from the native deceleration, so both don't fight over the content offset:
+            if (animated && [super isDecelerating]) {
+                [self setContentOffset:self.contentOffset animated:NO];
+            }
+            
+            [self _settleAtTargetContentOffset:contentOffset];
+            
             if (animated) {
-                [self.scrollAnimator animateScrollToContentOffset:contentOffset duration:0.55];
+                [self.scrollAnimator animateScrollToContentOffset:contentOffset duration:0.55 velocity:velocity];
             } else {
                 [self setContentOffset:contentOffset animated:NO];
+                [self _completeSnapAtContentOffset:contentOffset];
             }
         }
     }
 }
 
+- (CGPoint)_contentOffsetForPane:(UIView *)pane
+{
+    const CGRect frame = [self rectForPane:pane];
+    
+    CGRect bounds = self.bounds;
+    CGSize contentSize = self.contentSize;
+    
+    CGFloat maximumContentOffsetX = contentSize.width - CGRectGetWidth(bounds);
+    
+    return CGPointMake(MIN(maximumContentOffsetX, frame.origin.x), 0);
+}
+
 - (NSArray <UIView *> *)panesInRect:(CGRect)rect
 {
-    if (self.panes.count == 0) {
+    const NSRange range = [self rangeOfPanesInRect:rect];
+    
+    if (range.length == 0) {
         return @[];
     }
     
-    NSMutableArray *visiblePanes = [NSMutableArray arrayWithCapacity:self.panes.count];
+    return [self.panes subarrayWithRange:range];
+}
+
+- (NSRange)rangeOfPanesInRect:(CGRect)rect
+{
+    const CGFloat uniformPaneWidth = self.uniformPaneWidth;
+    
+    if (uniformPaneWidth > 0.0f) {
+        return [self rangeOfUniformPanesInRect:rect];
+    }
     
-    NSUInteger idx = 0;
-    for (NSValue *frame in self.framesForPanes) {
-        if (CGRectIntersectsRect(frame.CGRectValue, rect)) {
-            [visiblePanes addObject:self.panes[idx]];
+    NSArray <NSValue *> *framesForPanes = self.framesForPanes;
+    const NSUInteger count = MIN(framesForPanes.count, self.panes.count);
+    
+    if (count == 0 || CGRectIsNull(rect)) {
+        return NSMakeRange(0, 0);
+    }
+    
+    // Panes are laid out left to right, so binary search the first one that may intersect:
+    NSUInteger lower = 0;
+    NSUInteger upper = count;
+    
+    while (lower < upper) {
+        const NSUInteger middle = lower + (upper - lower) / 2;
+        
+        if (CGRectGetMaxX(framesForPanes[middle].CGRectValue) < CGRectGetMinX(rect)) {
+            lower = middle + 1;
+        } else {
+            upper = middle;
+        }
+    }
+    
+    NSUInteger location = NSNotFound;
+    NSUInteger length = 0;
+    
+    for (NSUInteger idx = lower; idx < count; idx++) {
+        const CGRect frame = framesForPanes[idx].CGRectValue;
+        
+        if (CGRectGetMinX(frame) > CGRectGetMaxX(rect)) {
+            break;
+        }
+        
+        if (CGRectIntersectsRect(frame, rect)) {
+            if (location == NSNotFound) {
+                location = idx;
+            }
+            length = (idx - location) + 1;
+        } else if (location != NSNotFound) {
+            break;
         }
-        idx += 1;
     }
     
-    return visiblePanes.copy;
+    if (location == NSNotFound) {
+        return NSMakeRange(0, 0);
+    }
+    
+    return NSMakeRange(location, length);
 }
 
-- (NSIndexSet *)indexesForVisiblePanes
+- (NSRange)rangeOfUniformPanesInRect:(CGRect)rect
 {
-    if (self.panes.count == 0) {
-        return [NSIndexSet indexSet];
+    const NSUInteger count = self.panes.count;
+    const CGFloat uniformPaneWidth = self.uniformPaneWidth;
+    
+    if (count == 0 || CGRectIsNull(rect)) {
+        return NSMakeRange(0, 0);
+    }
+    
+    const CGFloat contentWidth = uniformPaneWidth * count;
+    const CGFloat minX = CGRectGetMinX(rect);
+    const CGFloat maxX = CGRectGetMaxX(rect);
+    
+    // Like CGRectIntersectsRect, an empty rect still intersects the pane it lies in:
+    const BOOL isEmpty = (maxX <= minX);
+    
+    if (minX >= contentWidth || maxX < 0.0f || (!isEmpty && maxX <= 0.0f)) {
+        return NSMakeRange(0, 0);
+    }
+    
+    // Every pane has the same width, so the range follows from the edges of the rect:
+    const NSUInteger first = (minX < 0.0f) ? 0 : MIN((NSUInteger)floor(minX / uniformPaneWidth), count - 1);
+    NSUInteger last = isEmpty ? first : MIN((NSUInteger)floor(MIN(maxX, contentWidth) / uniformPaneWidth), count - 1);
+    
+    // A rect ending right on a pane boundary doesn't intersect the next pane:
+    if (last > first && (CGFloat)last * uniformPaneWidth >= maxX) {
+        last -= 1;
     }
     
-    NSMutableIndexSet *indexSet = [NSMutableIndexSet indexSet];
+    return NSMakeRange(first, (last - first) + 1);
+}
+
+- (CGRect)frameForPaneAtIndex:(NSUInteger)idx
+{
+    const CGFloat uniformPaneWidth = self.uniformPaneWidth;
+    
+    if (uniformPaneWidth > 0.0f) {
+        return (CGRect){
+            .origin.x = uniformPaneWidth * idx,
+            .size.width = uniformPaneWidth,
+            .size.height = self.sizingBoundsSize.height
+        };
+    }
     
-    for (UIView *pane in self.visiblePanes) {
-        [indexSet addIndex:[self.panes indexOfObject:pane]];
+    return self.framesForPanes[idx].CGRectValue;
+}
+
+- (NSIndexSet *)indexesForVisiblePanes
+{
+    return [NSIndexSet indexSetWithIndexesInRange:self.rangeForVisiblePanes];
+}
+
+- (NSUInteger)indexOfPane:(UIView *)pane
+{
+    if (!pane) {
+        return NSNotFound;
     }
     
-    return indexSet;
+    NSNumber *idx = [self.indexesForPanes objectForKey:pane];
+    
+    return (idx != nil) ? idx.unsignedIntegerValue : NSNotFound;
 }
 
 - (CGRect)rectForPane:(UIView *)pane
 {
-    NSUInteger idx = [self.panes indexOfObject:pane];
-    if (idx != NSNotFound) {
-        return self.framesForPanes[idx].CGRectValue;
+    NSUInteger idx = [self indexOfPane:pane];
+    if (idx != NSNotFound && (self.uniformPaneWidth > 0.0f || idx < self.framesForPanes.count)) {
+        return [self frameForPaneAtIndex:idx];
     }
     return CGRectNull;
 }
 
+NS_INLINE NSUInteger MMSplitFirstIndexInRange(NSRange range){
+    return (range.length > 0) ? range.location : NSNotFound;
+};
+
 - (void)calculateLayoutForCurrentBounds
 {
     // Layout if bounds size changes:
     if (self.isContentSizeInvalidated) {
         self.contentSizeInvalidated = NO;
         
-        UIView *leadingPane = nil;
-        
-        for (UIView *pane in self.panes) {
-            if ([self.visiblePanes containsObject:pane]) {
-                leadingPane = pane;
-                break;
-            }
+        // Use the precomputed destination layout if transitioning:
+        if (self.sizeTransition) {
+            [self commitSizeTransition:self.sizeTransition];
+            return;
         }
         
+        const NSUInteger leadingIndex = MMSplitFirstIndexInRange(self.rangeForVisiblePanes);
+        UIView *leadingPane = (leadingIndex != NSNotFound) ? self.panes[leadingIndex] : nil;
+        
         [self reloadSizingData];
-        [self scrollToPane:leadingPane animated:NO];
+        
+        // Keep the leading pane in place. This isn't a snap, so don't notify from inside layout:
+        if (leadingPane != nil && [self indexOfPane:leadingPane] != NSNotFound) {
+            const CGPoint contentOffset = [self _contentOffsetForPane:leadingPane];
+            
+            if (!CGPointEqualToPoint(contentOffset, self.contentOffset)) {
+                [self setContentOffset:contentOffset animated:NO];
+            }
+        }
     }
 }
 
 - (void)notifyPaneBeingSnappedIfNeeded
 {
-    if (self.isTracking || self.isDecelerating) {
+    // Gestures and animations report their own snaps:
+    if (self.isTracking || self.isDecelerating || self.scrollAnimator.isAnimating || self.snapState == MMSplitSnapStateTargeting) {
         return;
     }
     
-    if (self.panes.count > 0 && self.snappedPaneIndex != self.indexesForVisiblePanes.firstIndex) {
+    if (self.panes.count > 0 && self.snappedPaneIndex != MMSplitFirstIndexInRange(self.rangeForVisiblePanes)) {
         CGPoint contentOffset = self.contentOffset;
         
-        [self _notifySnapToTargetContentOffset:contentOffset completed:NO];
+        [self _settleAtTargetContentOffset:contentOffset];
         
         if (self.layer.animationKeys) {
+            __weak typeof(self) weakSelf = self;
+            
             [CATransaction setCompletionBlock:^{
-                [self _notifySnapToTargetContentOffset:contentOffset completed:YES];
+                [weakSelf _completeSnapAtContentOffset:contentOffset];
             }];
         } else {
-            [self _notifySnapToTargetContentOffset:contentOffset completed:YES];
+            [self _completeSnapAtContentOffset:contentOffset];
         }
     }
 }
@@ -226,34 +414,77 @@
     CGRect visibleRect = bounds;
     visibleRect.origin = contentOffset;
     
-    const auto NSArray <UIView *> *visiblePanes = [self panesInRect:visibleRect];
+    NSArray <UIView *> *panes = self.panes;
+    
+    const NSRange previousRange = self.rangeForVisiblePanes;
+    const NSRange visibleRange = [self rangeOfPanesInRect:visibleRect];
     const auto id <MMSplitScrollViewDelegate> delegate = self.delegate;
     
-    const BOOL delegateDidEndDisplayingView = _delegateFlags.delegateDidEndDisplayingView;
-    const BOOL delegateWillDisplayView = _delegateFlags.delegateWillDisplayView;
+    const BOOL delegateDisplayPages = _delegateFlags.delegateDisplayPages;
+    const BOOL delegateDidEndDisplayingView = _delegateFlags.delegateDidEndDisplayingView && !delegateDisplayPages;
+    const BOOL delegateWillDisplayView = _delegateFlags.delegateWillDisplayView && !delegateDisplayPages;
+    const BOOL isPagingEnabled = self.isPagingEnabled;
+    const BOOL usesSharedChromeRenderer = self.usesSharedChromeRenderer;
+    const CGFloat maximumContentOffsetX = self.contentSize.width - CGRectGetWidth(bounds);
     
-    // Collect and remove panes that shouldn't be visible anymore:
-    NSMutableSet *removedPanes = [NSMutableSet set];
+    MMSplitPaneChrome *chromes = NULL;
+    NSUInteger chromeCount = 0;
     
-    for (UIView *pane in self.visiblePanes) {
-        if (![visiblePanes containsObject:pane]) {
-            [pane removeFromSuperview];
-            [removedPanes addObject:pane];
-            
-            if (delegateDidEndDisplayingView) {
-                [delegate scrollView:self didEndDisplayingView:pane atPage:[self.panes indexOfObject:pane]];
+    if (usesSharedChromeRenderer) {
+        const NSUInteger length = visibleRange.length * sizeof(MMSplitPaneChrome);
+        if (self.chromeBuffer.length < length) {
+            self.chromeBuffer.length = length;
+        }
+        chromes = self.chromeBuffer.mutableBytes;
+    }
+    
+    NSMutableIndexSet *removedPages = nil;
+    NSMutableIndexSet *insertedPages = nil;
+    
+    // Remove panes that shouldn't be visible anymore:
+    for (NSUInteger idx = previousRange.location; idx < NSMaxRange(previousRange); idx++) {
+        if (NSLocationInRange(idx, visibleRange)) {
+            continue;
+        }
+        
+        UIView *pane = panes[idx];
+        [pane removeFromSuperview];
+        
+        if (delegateDisplayPages) {
+            if (!removedPages) {
+                removedPages = [NSMutableIndexSet indexSet];
             }
+            [removedPages addIndex:idx];
+        } else if (delegateDidEndDisplayingView) {
+            [delegate scrollView:self didEndDisplayingView:pane atPage:idx];
         }
     }
     
-    [self.visiblePanes minusSet:removedPanes];
+    self.rangeForVisiblePanes = visibleRange;
+    
+    // Report the whole change at once, before new panes join the hierarchy:
+    if (delegateDisplayPages) {
+        for (NSUInteger idx = visibleRange.location; idx < NSMaxRange(visibleRange); idx++) {
+            if (!NSLocationInRange(idx, previousRange)) {
+                if (!insertedPages) {
+                    insertedPages = [NSMutableIndexSet indexSet];
+                }
+                [insertedPages addIndex:idx];
+            }
+        }
+        
+        if (removedPages != nil || insertedPages != nil) {
+            [delegate scrollView:self didEndDisplayingPages:(removedPages ?: [NSIndexSet indexSet]) willDisplayPages:(insertedPages ?: [NSIndexSet indexSet])];
+        }
+    }
     
     // Layout visible panes:
-    for (UIView *pane in visiblePanes) {
-        const BOOL isBeingDisplayed = [self.visiblePanes containsObject:pane];
+    for (NSUInteger idx = visibleRange.location; idx < NSMaxRange(visibleRange); idx++) {
+        UIView *pane = panes[idx];
         
-        NSUInteger idx = [self.panes indexOfObject:pane];
-        CGRect rect = self.framesForPanes[idx].CGRectValue;
+        const BOOL isBeingDisplayed = NSLocationInRange(idx, previousRange);
+        
+        CGRect rect = [self frameForPaneAtIndex:idx];
         
         if ([self shouldPinToVisibleBoundsInPane:pane]) {
             CGRect availableRect = rect;
@@ -266,7 +497,7 @@
         
         if ([pane conformsToProtocol:@protocol(MMSplitHuggingSupporting)]) {
             const BOOL isBehindContentOffset = (CGRectGetMinX(rect) < contentOffset.x);
-            const BOOL canDisappear = CGRectGetMaxX(rect) <= self.contentSize.width - CGRectGetWidth(bounds);
+            const BOOL canDisappear = CGRectGetMaxX(rect) <= maximumContentOffsetX;
             
             CGFloat percent = 0.0f;
             if (canDisappear && isBehindContentOffset) {
@@ -277,24 +508,69 @@
             }
             
             [(id <MMSplitHuggingSupporting>)pane setHuggingProgress:percent];
-            [(id <MMSplitHuggingSupporting>)pane setPagingEnabled:self.isPagingEnabled];
+            [(id <MMSplitHuggingSupporting>)pane setPagingEnabled:isPagingEnabled];
+            
+            if (chromes != NULL) {
+                chromes[chromeCount++] = (MMSplitPaneChrome){
+                    .frame = rect,
+                    .visibleMaxX = CGFLOAT_MAX,
+                    .huggingProgress = percent
+                };
+            }
         }
         
         if (!isBeingDisplayed) {
+            if ([pane isKindOfClass:[MMSplitPaneView class]]) {
+                [(MMSplitPaneView *)pane setRendersChrome:!usesSharedChromeRenderer];
+            }
+            
             if (delegateWillDisplayView) {
                 [delegate scrollView:self willDisplayView:pane atPage:idx];
             }
             
-            UIView *siblingPane = (idx + 1 < self.panes.count) ? self.panes[idx + 1] : nil;
-            if (siblingPane != nil) {
+            UIView *siblingPane = (idx + 1 < panes.count) ? panes[idx + 1] : nil;
+            if (siblingPane != nil && siblingPane.superview == self) {
                 [self insertSubview:pane belowSubview:siblingPane];
             } else {
                 [self addSubview:pane];
             }
-            
-            [self.visiblePanes addObject:pane];
         }
     }
+    
+    if (usesSharedChromeRenderer) {
+        UIView *topPane = (visibleRange.length > 0) ? panes[NSMaxRange(visibleRange) - 1] : nil;
+        
+        [self layoutChromeLayerWithChromes:chromes count:chromeCount abovePane:topPane];
+    }
+}
+
+- (void)layoutChromeLayerWithChromes:(MMSplitPaneChrome *)chromes count:(NSUInteger)count abovePane:(UIView *)topPane
+{
+    // Each pane is covered by the panes stacked above it:
+    CGFloat visibleMaxX = CGFLOAT_MAX;
+    
+    for (NSUInteger idx = count; idx > 0; idx--) {
+        chromes[idx - 1].visibleMaxX = visibleMaxX;
+        visibleMaxX = MIN(visibleMaxX, CGRectGetMinX(chromes[idx - 1].frame));
+    }
+    
+    MMSplitPaneChromeLayer *chromeLayer = self.chromeLayer;
+    
+    // Stay right above the front-most pane, which may have just been added, and below the bounce overlays:
+    CALayer *paneLayer = topPane.layer;
+    
+    if (paneLayer != nil) {
+        NSArray <CALayer *> *sublayers = self.layer.sublayers;
+        const NSUInteger paneIndex = [sublayers indexOfObjectIdenticalTo:paneLayer];
+        
+        if (paneIndex != NSNotFound && (paneIndex + 1 >= sublayers.count || sublayers[paneIndex + 1] != chromeLayer)) {
+            [self.layer insertSublayer:chromeLayer above:paneLayer];
+        }
+    }
+    
+    chromeLayer.drawsDropShadows = self.isPagingEnabled;
+    
+    [chromeLayer setChromes:chromes count:count];
 }
 
 - (BOOL)shouldPinToVisibleBoundsInPane:(UIView *)pane
@@ -303,17 +579,23 @@
         return NO;
     }
     
-    if ([self.panes indexOfObject:pane] != 0) {
-        return NO;
-    }
+    return (pane != nil && pane == self.pinnablePane);
+}
+
+- (void)updatePinnablePane
+{
+    UIView *pane = self.panes.firstObject;
+    UIView *pinnablePane = nil;
     
     if ([pane isKindOfClass:[MMSplitPaneView class]]) {
         MMSplitPaneView *splitPaneView = (MMSplitPaneView *)pane;
         
-        return [splitPaneView.contentView isKindOfClass:[MMSplitScrollView class]];
+        if ([splitPaneView.contentView isKindOfClass:[MMSplitScrollView class]]) {
+            pinnablePane = pane;
+        }
     }
     
-    return NO;
+    self.pinnablePane = pinnablePane;
 }
 
 - (void)layoutBounceCornersOverlayIfNeeded
@@ -344,15 +626,8 @@
         const CGRect externalRect = [self.superview convertRect:self.frame toView:self.window];
         
         if (isAtBeginning && CGRectGetMinX(externalRect) == CGRectGetMinX(screenRect)) {
-            BOOL atLeastOnePinnedPane = NO;
-            if (isAtBeginning) {
-                for (UIView *pane in _visiblePanes) {
-                    if ([self shouldPinToVisibleBoundsInPane:pane]) {
-                        atLeastOnePinnedPane = YES;
-                        break;
-                    }
-                }
-            }
+            const NSUInteger leadingIndex = MMSplitFirstIndexInRange(self.rangeForVisiblePanes);
+            const BOOL atLeastOnePinnedPane = (leadingIndex == 0 && [self shouldPinToVisibleBoundsInPane:self.panes.firstObject]);
             
             if (!atLeastOnePinnedPane) {
                 corners = (UIRectCornerTopLeft | UIRectCornerBottomLeft);
@@ -383,7 +658,21 @@
 {
     [super layoutSubviews];
     
+    [self trackVelocity];
     [self calculateLayoutForCurrentBounds];
+    
+    // Skip the pass if neither the visible rect nor the sizing inputs changed:
+    CGRect visibleRect = self.bounds;
+    visibleRect.origin = self.contentOffset;
+    
+    if (!self.isLayoutInvalidated && CGRectEqualToRect(visibleRect, self.layoutVisibleRect)) {
+        return;
+    }
+    
+    self.layoutInvalidated = NO;
+    self.layoutVisibleRect = visibleRect;
+    
+    [self updatePinnablePane];
     [self layoutVisiblePanes];
     [self layoutBounceCornersOverlayIfNeeded];
     [self notifyPaneBeingSnappedIfNeeded];
@@ -416,30 +705,99 @@
     if (pagingEnabled != self.isPagingEnabled) {
         [super setPagingEnabled:pagingEnabled];
         
+        self.sizeTransition = nil;
+        
         [self reloadSizingData];
         [self setNeedsLayout];
     }
 }
 
+NS_INLINE CGSize MMSplitContentSizeForFrames(NSArray <NSValue *> *frames, CGSize boundsSize){
+    const CGFloat width = (frames.count > 0) ? CGRectGetMaxX(frames.lastObject.CGRectValue) : 0.0f;
+    
+    return (CGSize){ width, boundsSize.height };
+};
+
+- (void)setFramesForPanes:(NSArray<NSValue *> *)framesForPanes
+{
+    _framesForPanes = framesForPanes;
+    
+    // Explicit frames take over from a uniform layout:
+    if (framesForPanes != nil) {
+        _uniformPaneWidth = 0.0f;
+    }
+    
+    self.layoutInvalidated = YES;
+}
+
+- (void)didMoveToWindow
+{
+    [super didMoveToWindow];
+    
+    self.layoutInvalidated = YES;
+    
+    [self updateChromeLayerAppearance];
+}
+
+- (void)traitCollectionDidChange:(UITraitCollection *)previousTraitCollection
+{
+    [super traitCollectionDidChange:previousTraitCollection];
+    
+    [self updateChromeLayerAppearance];
+}
+
 - (void)reloadSizingData
 {
-    CGRect bounds = (CGRect){
-        .size = self.bounds.size
-    };
+    const CGSize boundsSize = self.bounds.size;
+    
+    // Pages are as wide as the bounds, so resolve their frames in closed form:
+    if (self.isPagingEnabled) {
+        self.sizingBoundsSize = boundsSize;
+        self.framesForPanes = nil;
+        self.uniformPaneWidth = boundsSize.width;
+        self.contentSize = (CGSize){ boundsSize.width * self.panes.count, boundsSize.height };
+        return;
+    }
+    
+    NSArray <NSValue *> *framesForPanes = [self framesForPanesWithBoundsSize:boundsSize];
     
+    self.framesForPanes = framesForPanes;
+    self.contentSize = MMSplitContentSizeForFrames(framesForPanes, boundsSize);
+}
+
+- (NSArray <NSValue *> *)framesForPanesWithBoundsSize:(CGSize)boundsSize
+{
     const BOOL isPagingEnabled = self.isPagingEnabled;
     const auto id <MMSplitScrollViewDelegate> delegate = self.delegate;
     
-    CGSize contentSize = bounds.size;
+    self.sizingBoundsSize = boundsSize;
+    
     CGPoint offset = CGPointZero;
     NSUInteger idx = 0;
     
-    NSMutableArray <NSValue *> *framesForPanes = [NSMutableArray arrayWithCapacity:self.panes.count];
+    const NSUInteger count = self.panes.count;
+    
+    NSMutableArray <NSValue *> *framesForPanes = [NSMutableArray arrayWithCapacity:count];
+    
+    // Prefer resolving all widths in a single pass:
+    NSMutableData *widths = nil;
+    
+    if (!isPagingEnabled && _delegateFlags.delegateGetWidths && count > 0) {
+        widths = [NSMutableData dataWithLength:count * sizeof(CGFloat)];
+        
+        if (![delegate scrollView:self getWidths:widths.mutableBytes count:count]) {
+            widths = nil;
+        }
+    }
+    
+    const CGFloat *resolvedWidths = widths.bytes;
     
     for (UIView *pane in self.panes) {
-        CGSize size = contentSize;
+        CGSize size = boundsSize;
         
-        if (!isPagingEnabled && _delegateFlags.delegateSizeForPage) {
+        if (resolvedWidths != NULL) {
+            size.width = resolvedWidths[idx];
+        } else if (!isPagingEnabled && _delegateFlags.delegateSizeForPage) {
             size.width = [delegate scrollView:self sizeForView:pane atPage:idx].width;
         }
         
@@ -454,24 +812,165 @@
         idx += 1;
     }
     
-    self.framesForPanes = framesForPanes;
-    self.contentSize = (CGSize){ offset.x, contentSize.height };
+    return framesForPanes;
+}
+
+#pragma mark - Size transitions.
+
+- (void)transitionToSize:(CGSize)size withTransitionCoordinator:(id<UIViewControllerTransitionCoordinator>)coordinator
+{
+    const CGSize sourceSize = self.bounds.size;
+    const NSUInteger count = self.panes.count;
+    
+    if (CGSizeEqualToSize(size, sourceSize) || count == 0) {
+        return;
+    }
+    
+    // Bring the source layout up to date before anchoring to it:
+    if (self.isContentSizeInvalidated && !self.sizeTransition) {
+        [self calculateLayoutForCurrentBounds];
+    }
+    
+    _MMSplitScrollViewSizeTransition *transition = [[_MMSplitScrollViewSizeTransition alloc] init];
+    transition.destinationSize = size;
+    
+    // Pages stay as wide as the bounds, so keep the closed form layout:
+    if (self.isPagingEnabled) {
+        transition.destinationUniformPaneWidth = size.width;
+        transition.destinationContentSize = (CGSize){ size.width * count, size.height };
+    } else {
+        NSArray <NSValue *> *destinationFrames = [self framesForPanesWithBoundsSize:size];
+    
+        self.sizingBoundsSize = sourceSize;
+    
+        transition.destinationFrames = destinationFrames;
+        transition.destinationContentSize = MMSplitContentSizeForFrames(destinationFrames, size);
+    }
+    
+    // Anchor the destination layout to the leading visible pane:
+    const NSUInteger leadingIndex = MMSplitFirstIndexInRange(self.rangeForVisiblePanes);
+    
+    if (leadingIndex != NSNotFound && leadingIndex < count) {
+        const CGFloat maximumContentOffsetX = MAX(transition.destinationContentSize.width - size.width, 0.0f);
+        const CGFloat leadingOffsetX = (transition.destinationFrames != nil) ? CGRectGetMinX(transition.destinationFrames[leadingIndex].CGRectValue) : transition.destinationUniformPaneWidth * leadingIndex;
+    
+        transition.destinationContentOffset = (CGPoint){ MIN(maximumContentOffsetX, leadingOffsetX), 0.0f };
+    }
+    
+    self.sizeTransition = transition;
+    
+    __weak typeof(self) weakSelf = self;
+    
+    // Install the destination layout inside the coordinator's animation, so panes animate along with the bounds:
+    [coordinator animateAlongsideTransition:^(id<UIViewControllerTransitionCoordinatorContext> context) {
+        [weakSelf commitSizeTransition:transition];
+        [weakSelf layoutIfNeeded];
+    } completion:^(id<UIViewControllerTransitionCoordinatorContext> context) {
+        [weakSelf finishSizeTransition:transition];
+    }];
+}
+
+- (void)commitSizeTransition:(_MMSplitScrollViewSizeTransition *)transition
+{
+    if (transition != self.sizeTransition || transition.isCommitted) {
+        return;
+    }
+    
+    const CGSize destinationSize = transition.destinationSize;
+    
+    self.sizingBoundsSize = destinationSize;
+    
+    if (transition.destinationUniformPaneWidth > 0.0f) {
+        self.framesForPanes = nil;
+        self.uniformPaneWidth = transition.destinationUniformPaneWidth;
+    } else {
+        self.framesForPanes = transition.destinationFrames;
+    }
+    
+    self.contentSize = transition.destinationContentSize;
+    self.contentOffset = transition.destinationContentOffset;
+    
+    transition.committed = YES;
+    
+    [self setNeedsLayout];
+}
+
+- (void)finishSizeTransition:(_MMSplitScrollViewSizeTransition *)transition
+{
+    if (transition != self.sizeTransition) {
+        return;
+    }
+    
+    self.sizeTransition = nil;
+    
+    // Fall back to a full layout if the transition was cancelled or interrupted:
+    if (!transition.isCommitted || !CGSizeEqualToSize(self.bounds.size, transition.destinationSize)) {
+        [self invalidatePaneSizes];
+    }
 }
 
 - (void)setPanes:(NSArray<UIView *> *)panes
 {
     if (![panes isEqualToArray:_panes]) {
-        NSMutableSet *removedPanes = [NSMutableSet set];
-        for (UIView *visiblePane in self.visiblePanes) {
-            if (![panes containsObject:visiblePane]) {
+        NSMapTable <UIView *, NSNumber *> *indexesForPanes = [NSMapTable strongToStrongObjectsMapTable];
+        
+        [panes enumerateObjectsUsingBlock:^(UIView *pane, NSUInteger idx, BOOL *stop) {
+            [indexesForPanes setObject:@(idx) forKey:pane];
+        }];
+        
+        // Keep displayed panes that are still part of the split view, as long as they stay contiguous:
+        NSArray <UIView *> *previousPanes = _panes;
+        const NSRange previousRange = self.rangeForVisiblePanes;
+        
+        NSUInteger location = NSNotFound;
+        NSUInteger length = 0;
+        
+        NSMutableIndexSet *removedPages = [NSMutableIndexSet indexSet];
+        
+        for (NSUInteger idx = previousRange.location; idx < NSMaxRange(previousRange); idx++) {
+            UIView *visiblePane = previousPanes[idx];
+            NSNumber *newIndex = [indexesForPanes objectForKey:visiblePane];
+            
+            const BOOL isContiguous = (newIndex != nil && (location == NSNotFound || newIndex.unsignedIntegerValue == location + length));
+            
+            if (isContiguous) {
+                if (location == NSNotFound) {
+                    location = newIndex.unsignedIntegerValue;
+                }
+                length += 1;
+            } else {
                 [visiblePane removeFromSuperview];
-                [removedPanes addObject:visiblePane];
+                
+                if (newIndex == nil) {
+                    continue;
+                }
+                
+                if (_delegateFlags.delegateDisplayPages) {
+                    [removedPages addIndex:newIndex.unsignedIntegerValue];
+                } else if (_delegateFlags.delegateDidEndDisplayingView) {
+                    [self.delegate scrollView:self didEndDisplayingView:visiblePane atPage:newIndex.unsignedIntegerValue];
+                }
             }
         }
-        [self.visiblePanes minusSet:removedPanes];
+        
+        self.rangeForVisiblePanes = (location != NSNotFound) ? NSMakeRange(location, length) : NSMakeRange(0, 0);
+        self.indexesForPanes = indexesForPanes;
         
         _panes = [panes copy];
         
+        // Pages are reported against the new panes:
+        if (removedPages.count > 0) {
+            [self.delegate scrollView:self didEndDisplayingPages:removedPages willDisplayPages:[NSIndexSet indexSet]];
+        }
+        
+        self.sizeTransition = nil;
+        
+        // Indexes no longer refer to the same panes:
+        self.snapState = MMSplitSnapStateIdle;
+        self.snapTargetIndex = NSNotFound;
+        
+        [self updatePinnablePane];
+        
         [self reloadSizingData];
         [self setNeedsLayout];
     }
@@ -494,10 +993,12 @@
     [super setDelegate:(id <UIScrollViewDelegate>)self.delegateForwarder];
     
     _delegateFlags.delegateSizeForPage = [delegate respondsToSelector:@selector(scrollView:sizeForView:atPage:)];
+    _delegateFlags.delegateGetWidths = [delegate respondsToSelector:@selector(scrollView:getWidths:count:)];
     _delegateFlags.delegateWillSnapToPage = [delegate respondsToSelector:@selector(scrollView:willSnapToView:atPage:)];
     _delegateFlags.delegateDidSnapToPage = [delegate respondsToSelector:@selector(scrollView:didSnapToView:atPage:)];
     _delegateFlags.delegateDidEndDisplayingView = [delegate respondsToSelector:@selector(scrollView:didEndDisplayingView:atPage:)];
     _delegateFlags.delegateWillDisplayView = [delegate respondsToSelector:@selector(scrollView:willDisplayView:atPage:)];
+    _delegateFlags.delegateDisplayPages = [delegate respondsToSelector:@selector(scrollView:didEndDisplayingPages:willDisplayPages:)];
 }
 
 - (id<MMSplitScrollViewDelegate>)delegate
@@ -519,60 +1020,115 @@
 
 - (void)scrollViewWillEndDragging:(UIScrollView *)scrollView withVelocity:(CGPoint)velocity targetContentOffset:(inout CGPoint *)targetContentOffset
 {
+    // A quick grab of a moving spring keeps its direction (velocity is in points per millisecond here):
+    if (velocity.x == 0.0f && CACurrentMediaTime() - self.handoffTimestamp < MMSplitHandoffInterval) {
+        velocity.x = self.handoffVelocity.x / 1000.0f;
+    }
+    
     // If UIScrollView's paging is off, do our own targetContentOffset calculations.
     if (!self.isPagingEnabled) {
         *targetContentOffset = [self _targetContentOffsetForProposedContentOffset:*targetContentOffset withScrollingVelocity:velocity];
     }
     
     if (!CGPointEqualToPoint(*targetContentOffset, scrollView.contentOffset)) {
-        [self _notifySnapToTargetContentOffset:*targetContentOffset completed:NO];
+        [self _settleAtTargetContentOffset:*targetContentOffset];
+    }
+}
+
+- (void)scrollViewDidEndDragging:(UIScrollView *)scrollView willDecelerate:(BOOL)decelerate
+{
+    // Released in place, so there's nothing left to settle:
+    if (!decelerate) {
+        [self _completeSnapAtContentOffset:scrollView.contentOffset];
     }
 }
 
 - (void)scrollViewDidEndDecelerating:(UIScrollView *)scrollView
 {
     // Notify the delegate snapping did happen.
-    [self _notifySnapToTargetContentOffset:scrollView.contentOffset completed:YES];
+    [self _completeSnapAtContentOffset:scrollView.contentOffset];
 }
 
 - (void)scrollViewWillBeginDragging:(UIScrollView *)scrollView
 {
     // If user begin dragging, cancel the scroll animation and remove animation views.
     if (self.scrollAnimator.isAnimating) {
+        self.handoffVelocity = self.currentVelocity;
+        self.handoffTimestamp = CACurrentMediaTime();
+        
         [self.scrollAnimator cancelAnimation];
+    } else {
+        self.handoffVelocity = CGPointZero;
+        self.handoffTimestamp = 0.0;
     }
+    
+    self.snapState = MMSplitSnapStateTargeting;
+    self.snapTargetIndex = NSNotFound;
 }
 
 - (void)scrollViewDidEndScrollingAnimation:(UIScrollView *)scrollView
 {
     // Notify the delegate snapping did happen after animation completes.
-    [self _notifySnapToTargetContentOffset:scrollView.contentOffset completed:YES];
+    [self _completeSnapAtContentOffset:scrollView.contentOffset];
 }
 
-#pragma mark - Adjusting content offset.
+#pragma mark - Snapping.
 
-- (void)_notifySnapToTargetContentOffset:(CGPoint)targetContentOffset completed:(BOOL)completed
+- (NSUInteger)_pageForTargetContentOffset:(CGPoint)targetContentOffset
 {
-    id <MMSplitScrollViewDelegate> delegate = self.delegate;
-    
     CGRect proposedRect = self.bounds;
     proposedRect.origin.x = MIN(ceil(targetContentOffset.x), self.contentSize.width - CGRectGetWidth(proposedRect));
     proposedRect.origin.y = ceil(targetContentOffset.y);
     
-    UIView *pane = [self panesInRect:proposedRect].firstObject;
-    if (pane) {
-        NSUInteger page = [self.panes indexOfObject:pane];
-        if (completed) {
-            if (_delegateFlags.delegateDidSnapToPage) {
-                [delegate scrollView:self didSnapToView:pane atPage:page];
-            }
-        } else {
-            if (_delegateFlags.delegateWillSnapToPage) {
-                [delegate scrollView:self willSnapToView:pane atPage:page];
-            }
-        }
-        
-        self.snappedPaneIndex = page;
+    return MMSplitFirstIndexInRange([self rangeOfPanesInRect:proposedRect]);
+}
+
+- (void)_settleAtTargetContentOffset:(CGPoint)targetContentOffset
+{
+    const NSUInteger page = [self _pageForTargetContentOffset:targetContentOffset];
+    if (page == NSNotFound) {
+        return;
+    }
+    
+    // Already settling on this page, don't notify again:
+    if (self.snapState == MMSplitSnapStateSettling && self.snapTargetIndex == page) {
+        return;
+    }
+    
+    self.snapState = MMSplitSnapStateSettling;
+    self.snapTargetIndex = page;
+    self.snappedPaneIndex = page;
+    
+    if (_delegateFlags.delegateWillSnapToPage) {
+        [self.delegate scrollView:self willSnapToView:self.panes[page] atPage:page];
+    }
+}
+
+- (void)_completeSnapAtContentOffset:(CGPoint)contentOffset
+{
+    const BOOL settling = (self.snapState == MMSplitSnapStateSettling);
+    
+    // The target was resolved when settling began, so only resolve it again if there wasn't one:
+    NSUInteger page = settling ? self.snapTargetIndex : NSNotFound;
+    if (page == NSNotFound || page >= self.panes.count) {
+        page = [self _pageForTargetContentOffset:contentOffset];
+    }
+    
+    if (page == NSNotFound) {
+        self.snapState = MMSplitSnapStateIdle;
+        self.snapTargetIndex = NSNotFound;
+        return;
+    }
+    
+    // Coming to rest on the page that was already snapped isn't a new snap:
+    const BOOL notifies = (settling || (NSInteger)page != self.snappedPaneIndex);
+    
+    self.snapState = MMSplitSnapStateSnapped;
+    self.snapTargetIndex = NSNotFound;
+    self.snappedPaneIndex = page;
+    
+    if (notifies && _delegateFlags.delegateDidSnapToPage) {
+        [self.delegate scrollView:self didSnapToView:self.panes[page] atPage:page];
     }
 }
 
@@ -583,9 +1139,9 @@
     
     CGFloat offsetAdjustment = CGRectGetMinX(targetRect);
     
-    UIView *firstPane = [self panesInRect:targetRect].firstObject;
-    if (firstPane) {
-        CGRect frame = [self rectForPane:firstPane];
+    const NSUInteger firstIndex = MMSplitFirstIndexInRange([self rangeOfPanesInRect:targetRect]);
+    if (firstIndex != NSNotFound) {
+        CGRect frame = [self frameForPaneAtIndex:firstIndex];
         
         // Go to next/prev one.
         if (CGRectGetMinX(targetRect) > CGRectGetMidX(frame) || fabs(velocity.x) > 0) {
@@ -643,6 +1199,44 @@
     return [super isDecelerating] || [self.scrollAnimator isAnimating];
 }
 
+#pragma mark - Velocity tracking.
+
+- (void)trackVelocity
+{
+    const CFTimeInterval timestamp = CACurrentMediaTime();
+    const CFTimeInterval deltaTime = timestamp - self.trackedTimestamp;
+    const CGPoint contentOffset = self.contentOffset;
+    
+    // Several passes in the same frame would make up huge velocities:
+    if (deltaTime < MMSplitVelocityMinimumSampleInterval) {
+        return;
+    }
+    
+    CGPoint velocity = CGPointZero;
+    
+    if (deltaTime < MMSplitVelocityMaximumSampleInterval) {
+        const CGPoint previousVelocity = self.trackedVelocity;
+        const CGPoint trackedContentOffset = self.trackedContentOffset;
+        
+        // Smooth out uneven frame timing:
+        velocity.x = 0.6f * ((contentOffset.x - trackedContentOffset.x) / deltaTime) + 0.4f * previousVelocity.x;
+        velocity.y = 0.6f * ((contentOffset.y - trackedContentOffset.y) / deltaTime) + 0.4f * previousVelocity.y;
+    }
+    
+    self.trackedVelocity = velocity;
+    self.trackedContentOffset = contentOffset;
+    self.trackedTimestamp = timestamp;
+}
+
+- (CGPoint)currentVelocity
+{
+    // Nothing moved for a while, so the content is at rest:
+    if (CACurrentMediaTime() - self.trackedTimestamp > MMSplitVelocityMaximumSampleInterval) {
+        return CGPointZero;
+    }
+    return self.trackedVelocity;
+}
+
 #pragma mark - Tap to snap.
 
 - (void)snapTapGestureRecognized:(UITapGestureRecognizer *)gestureRecognizer
@@ -657,6 +1251,60 @@
     }
 }
 
+#pragma mark - Shared chrome.
+
+- (void)setUsesSharedChromeRenderer:(BOOL)usesSharedChromeRenderer
+{
+    if (usesSharedChromeRenderer != _usesSharedChromeRenderer) {
+        _usesSharedChromeRenderer = usesSharedChromeRenderer;
+        
+        if (usesSharedChromeRenderer) {
+            self.chromeLayer = [MMSplitPaneChromeLayer layer];
+            self.chromeBuffer = [NSMutableData data];
+            
+            [self.layer addSublayer:self.chromeLayer];
+            [self updateChromeLayerAppearance];
+        } else {
+            [self.chromeLayer removeFromSuperlayer];
+            self.chromeLayer = nil;
+            self.chromeBuffer = nil;
+        }
+        
+        const NSRange visibleRange = self.rangeForVisiblePanes;
+        
+        for (NSUInteger idx = visibleRange.location; idx < NSMaxRange(visibleRange); idx++) {
+            UIView *pane = self.panes[idx];
+            
+            if ([pane isKindOfClass:[MMSplitPaneView class]]) {
+                [(MMSplitPaneView *)pane setRendersChrome:!usesSharedChromeRenderer];
+            }
+        }
+        
+        self.layoutInvalidated = YES;
+        
+        [self setNeedsLayout];
+    }
+}
+
+- (void)updateChromeLayerAppearance
+{
+    MMSplitPaneChromeLayer *chromeLayer = self.chromeLayer;
+    
+    if (!chromeLayer) {
+        return;
+    }
+    
+    UIScreen *screen = self.window.screen ?: UIScreen.mainScreen;
+    
+    chromeLayer.contentsScale = screen.scale;
+    
+#if __IPHONE_OS_VERSION_MAX_ALLOWED >= 130000
+    if (@available(iOS 13.0, *)) {
+        chromeLayer.separatorColor = [UIColor.separatorColor resolvedColorWithTraitCollection:self.traitCollection];
+    }
+#endif
+}
+
 #pragma mark - Bounce corners.
 
 - (void)setOverlayScreenCornersWhenBouncing:(BOOL)overlayScreenCornersWhenBouncing
@@ -669,6 +1317,8 @@
             self.bounceElasticBackgroundView = [[UIView alloc] initWithFrame:CGRectZero];
             self.bounceElasticBackgroundView.backgroundColor = UIColor.blackColor;
             
+            self.layoutInvalidated = YES;
+            
             [self setNeedsLayout];
         } else {
             [self.bounceCornersOverlayView removeFromSuperview];
@@ -680,3 +1330,7 @@
 }
 
 @end
+
+@implementation _MMSplitScrollViewSizeTransition
+
+@end
@@ -9,6 +9,7 @@
 #import "MMSplitViewController+MMSupplementaryBars.h"
 #import "MMSnapHeaderView.h"
 #import "MMSnapFooterView.h"
+#import "MMSplitReusePool.h"
 #import <objc/runtime.h>
 
 @interface MMSnapSupplementaryView (MMSnapSupplementaryViewPrivate)
@@ -18,6 +19,12 @@
 
 @end
 
+@interface MMSplitViewController (MMSplitViewControllerPrivateHooks)
+
+- (void)willDisplayViewControllers:(NSArray <UIViewController *> *)viewControllers;
+
+@end
+
 @implementation MMSplitViewController (MMSupplementaryBars)
 
 NS_INLINE void MMSwizzleInstanceMethod(Class class, SEL originalSelector, SEL swizzledSelector){
@@ -46,7 +53,7 @@ NS_INLINE void MMSwizzleInstanceMethod(Class class, SEL originalSelector, SEL sw
     dispatch_once(&onceToken, ^{
         Class class = [self class];
         MMSwizzleInstanceMethod(class, @selector(viewControllersDidChange:), @selector(snapSupplementaryView_viewControllersDidChange:));
-        MMSwizzleInstanceMethod(class, @selector(willDisplayViewController:), @selector(snapSupplementaryView_willDisplayViewController:));
+        MMSwizzleInstanceMethod(class, @selector(willDisplayViewControllers:), @selector(snapSupplementaryView_willDisplayViewControllers:));
         MMSwizzleInstanceMethod(class, @selector(willSnapToViewController:), @selector(snapSupplementaryView_willSnapToViewController:));
     });
 }
@@ -79,7 +86,7 @@ NS_INLINE void MMSwizzleInstanceMethod(Class class, SEL originalSelector, SEL sw
     }
     
     if (!view) {
-        view = [[viewClass alloc] initWithFrame:CGRectZero];
+        view = [[MMSplitReusePool sharedPool] dequeueViewOfClass:viewClass] ?: [[viewClass alloc] initWithFrame:CGRectZero];
         view.splitViewController = self;
         view.viewController = viewController;
         
@@ -127,6 +134,11 @@ NS_INLINE void MMSwizzleInstanceMethod(Class class, SEL originalSelector, SEL sw
         }
         
         [view snapControllerViewControllersDidChange];
+        
+        // The view controller may still reference its bars, so only reuse them once it goes away:
+        if ([removedViewControllers containsObject:viewController]) {
+            [[MMSplitReusePool sharedPool] recycleView:view whenObjectDeallocates:viewController];
+        }
     }
 }
 
@@ -139,12 +151,13 @@ NS_INLINE void MMSwizzleInstanceMethod(Class class, SEL originalSelector, SEL sw
     }
 }
 
-- (void)snapSupplementaryView_willDisplayViewController:(UIViewController *)viewController
+- (void)snapSupplementaryView_willDisplayViewControllers:(NSArray <UIViewController *> *)viewControllers
 {
-    [self snapSupplementaryView_willDisplayViewController:viewController];
+    [self snapSupplementaryView_willDisplayViewControllers:viewControllers];
     
+    // One pass over the supplementary views for the whole batch:
     for (MMSnapSupplementaryView *view in self.allSupplementaryViews.copy) {
-        if (view.viewController == viewController) {
+        if ([viewControllers containsObject:view.viewController]) {
             [view snapControllerWillDisplayViewController];
         }
     }
@@ -11,6 +11,8 @@
 NS_ASSUME_NONNULL_BEGIN
 
 @class MMSplitViewController;
+@class MMSplitEventStream;
+@class MMSplitFootprint;
 
 /**
  *  Constants indicating the preferred size for a child view controller in a column.
@@ -67,6 +69,69 @@ typedef NS_ENUM(NSUInteger, MMViewControllerDisplayMode){
     MMViewControllerDisplayModeAllVisible,
 };
 
+/**
+ *  A structure holding the inputs used to resolve the width of a column.
+ */
+typedef struct MMSplitColumnSizingContext {
+    /**
+     *  The bounds size of the split interface.
+     */
+    CGSize boundsSize;
+    
+    /**
+     *  The safe area insets of the split view controller's view.
+     */
+    UIEdgeInsets safeAreaInsets;
+    
+    /**
+     *  The resolved width of a primary-sized column.
+     */
+    CGFloat primaryColumnWidth;
+    
+    /**
+     *  The resolved minimum and maximum widths of a primary-sized column.
+     */
+    CGFloat minimumPrimaryColumnWidth;
+    CGFloat maximumPrimaryColumnWidth;
+    
+    /**
+     *  The resolved minimum width of a secondary-sized column.
+     */
+    CGFloat minimumSecondaryColumnWidth;
+    
+    /**
+     *  Whether the split interface is horizontally compact.
+     */
+    BOOL horizontallyCompact;
+} MMSplitColumnSizingContext;
+
+/**
+ *  The @c MMSplitColumnSizingProvider protocol defines a pure function that resolves the width of a column from its column size and a sizing context.
+ *
+ *  @note The split view controller may call this protocol from a background queue. Implementations must be thread-safe and must not access any UIKit state; everything they need is passed as parameters.
+ */
+@protocol MMSplitColumnSizingProvider <NSObject>
+
+/**
+ *  Returns the width of a column.
+ *
+ *  @param columnSize          The size of the column.
+ *  @param followingColumnSize The size of the column right after it, or @c MMViewControllerColumnSizeDefault if it is the last one.
+ *  @param context             The sizing context.
+ *
+ *  @return The width of the column, in points.
+ */
+- (CGFloat)widthForColumnSize:(MMViewControllerColumnSize)columnSize followingColumnSize:(MMViewControllerColumnSize)followingColumnSize context:(MMSplitColumnSizingContext)context;
+
+@end
+
+/**
+ *  Returns the width the split view controller resolves for a column by default. Sizing providers can call this function to fall back to the default behavior.
+ *
+ *  @note This function is thread-safe.
+ */
+extern CGFloat MMSplitColumnWidthForColumnSize(MMViewControllerColumnSize columnSize, MMViewControllerColumnSize followingColumnSize, MMSplitColumnSizingContext context);
+
 /**
  *  The @c MMSplitViewControllerDelegate protocol defines methods that allow you to manage changes to a split view interface. Use the methods of this protocol to respond to changes in the current display mode and to the current snapped view controller. When the split view interface collapses and scrolls, or when a new view controller is added to the interface, you can also use these methods to configure the child view controllers appropriately.
  */
@@ -76,6 +141,8 @@ typedef NS_ENUM(NSUInteger, MMViewControllerDisplayMode){
 /**
  *  Called by the split view controller when it needs the column size to use for displaying a child view controller.
  *
+ *  The column sizes are resolved again when the view controllers or the traits change. If the answer changes for any other reason, call @c -invalidateColumnSizes.
+ *
  *  @param splitViewController The split view controller instance.
  *  @param viewController      The view controller being displayed.
  *
@@ -126,6 +193,65 @@ typedef NS_ENUM(NSUInteger, MMViewControllerDisplayMode){
  */
 - (void)splitViewController:(MMSplitViewController *)splitViewController didSnapToViewController:(UIViewController *)viewController;
 
+/**
+ *  Called when the total backing store size of the split interface exceeds the footprint budget.
+ *
+ *  The split view controller calls this method once each time the footprint goes over the budget, and again only after it drops back within the budget.
+ *
+ *  @param splitViewController The split view controller instance.
+ *  @param footprint           The footprint that exceeded the budget.
+ */
+- (void)splitViewController:(MMSplitViewController *)splitViewController didExceedFootprintBudgetWithFootprint:(MMSplitFootprint *)footprint;
+
+@end
+
+/**
+ *  The @c MMSplitViewControllerDataSource protocol defines methods that supply the columns of a split view controller on demand. Use a data source instead of the @c viewControllers property when displaying a large number of columns: the split view controller only asks for the view controllers that are near the visible area, and releases them once they move far away.
+ */
+@protocol MMSplitViewControllerDataSource <NSObject>
+
+/**
+ *  Asks the data source for the number of columns in the split view controller.
+ *
+ *  @param splitViewController The split view controller instance.
+ *
+ *  @return The number of columns.
+ */
+- (NSInteger)numberOfColumnsInSplitViewController:(MMSplitViewController *)splitViewController;
+
+/**
+ *  Asks the data source for the size of the column at the specified index.
+ *
+ *  @note The split view controller calls this method for columns whose view controllers are not instantiated, so the result must not depend on them.
+ *
+ *  @param splitViewController The split view controller instance.
+ *  @param index               The index of the column.
+ *
+ *  @return A constant indicating the size of the column.
+ */
+- (MMViewControllerColumnSize)splitViewController:(MMSplitViewController *)splitViewController columnSizeForColumnAtIndex:(NSInteger)index;
+
+/**
+ *  Asks the data source for the view controller to display in the column at the specified index.
+ *
+ *  @param splitViewController The split view controller instance.
+ *  @param index               The index of the column.
+ *
+ *  @return A view controller that is not the child of another container.
+ */
+- (UIViewController *)splitViewController:(MMSplitViewController *)splitViewController viewControllerForColumnAtIndex:(NSInteger)index;
+
+@optional
+
+/**
+ *  Tells the data source the split view controller released the view controller of a column that moved far away from the visible area.
+ *
+ *  @param splitViewController The split view controller instance.
+ *  @param viewController      The view controller that was released.
+ *  @param index               The index of the column.
+ */
+- (void)splitViewController:(MMSplitViewController *)splitViewController didReleaseViewController:(UIViewController *)viewController forColumnAtIndex:(NSInteger)index;
+
 @end
 
 /**
@@ -154,6 +280,28 @@ extern CGFloat const MMSplitViewControllerAutomaticDimension;
  */
 @property (nonatomic, copy) NSArray <__kindof UIViewController *> *viewControllers;
 
+/**
+ *  The object that supplies the columns of the split view controller on demand.
+ *
+ *  @discussion Setting a data source replaces the view controllers of the split view controller. While a data source is set, the @c viewControllers property only contains the view controllers instantiated for the columns near the visible area; setting the @c viewControllers property removes the data source.
+ *
+ *  @note Primary-sized columns are never grouped together in a single column when using a data source.
+ */
+@property (weak, nonatomic, nullable) id <MMSplitViewControllerDataSource> dataSource;
+
+/**
+ *  Reloads the columns from the data source, releasing every view controller instantiated so far.
+ */
+- (void)reloadData;
+
+/**
+ *  Scrolls the split view controller to the column at the specified index, whether or not its view controller is instantiated.
+ *
+ *  @param index    The index of a column supplied by the data source.
+ *  @param animated Specify @c YES if you want to animate the transition.
+ */
+- (void)scrollToColumnAtIndex:(NSInteger)index animated:(BOOL)animated;
+
 /**
  *  Scrolls the split view controller to the specified view controller.
  *
@@ -161,6 +309,8 @@ extern CGFloat const MMSplitViewControllerAutomaticDimension;
  *  @param animated       Specify @c YES if you want to animate the transition.
  *
  *  @note This method does nothing if the view controller is not part of the child view controller stack.
+ *
+ *  @discussion Animated requests are coalesced and performed on the next turn of the main run loop, so successive calls result in a single animation to the last requested view controller. Non-animated requests are performed immediately.
  */
 - (void)scrollToViewController:(UIViewController *)viewController animated:(BOOL)animated;
 
@@ -239,6 +389,13 @@ extern CGFloat const MMSplitViewControllerAutomaticDimension;
  */
 @property (nonatomic, assign) CGFloat minimumSecondaryColumnWidth;
 
+/**
+ *  An object that resolves the width of the columns off the main thread.
+ *
+ *  When set, the split view controller resolves the column sizes on the main thread and computes the widths for the whole stack on a background queue after the view controllers, the traits or the bounds change. The result is applied on the next layout pass; until then, the widths from the previous pass are kept if they still apply. The default value of this property is @c nil.
+ */
+@property (strong, nonatomic, nullable) id <MMSplitColumnSizingProvider> columnSizingProvider;
+
 /**
  *  This property determines if the split view controller should attempt to mask the view’s content to the device’s screen corner radius.
  *
@@ -246,6 +403,27 @@ extern CGFloat const MMSplitViewControllerAutomaticDimension;
  */
 @property (nonatomic, assign) BOOL includesOpaqueRoundedCornersOverlay;
 
+/**
+ *  Determines if the split view controller draws the separators and overlays of all visible columns in a single shared layer.
+ *
+ *  Enable this property when displaying many columns to keep the number of layers constant. The default value of this property is @c NO.
+ */
+@property (nonatomic, assign) BOOL usesSharedChromeRenderer;
+
+/**
+ *  An event stream that receives a record of every display, snap, display mode and layout event of the split view controller.
+ *
+ *  Use an event stream instead of the delegate to observe the split interface from a background queue. Events are published without blocking and are dropped if the stream is full, so slow observers never delay scrolling. The default value of this property is @c nil.
+ */
+@property (strong, nonatomic, nullable) MMSplitEventStream *eventStream;
+
+/**
+ *  The maximum estimated backing store size of the split interface, in bytes, before the delegate is notified.
+ *
+ *  When set, the split view controller measures its footprint after the displayed view controllers change and calls @c -splitViewController:didExceedFootprintBudgetWithFootprint: on its delegate when the total goes over this value. The default value of this property is @c 0, which disables the check.
+ */
+@property (assign, nonatomic) uint64_t footprintBudget;
+
 /**
  *  Determines if gestures are disabled to transition between child view controllers.
  *
@@ -280,6 +458,42 @@ extern CGFloat const MMSplitViewControllerAutomaticDimension;
  */
 - (void)invalidateColumnSizes;
 
+/**
+ *  Groups several changes to the split view controller into a single reconfiguration.
+ *
+ *  Changes to properties such as @c viewControllers, @c preferredDisplayMode or the column width limits made inside the block are applied once, after the outermost block returns. Calls to @c -invalidateColumnSizes are coalesced as well. Transactions can be nested.
+ *
+ *  @param changes A block containing the changes to make.
+ */
+- (void)performConfigurationChanges:(void (NS_NOESCAPE ^)(void))changes;
+
+/**
+ *  Returns a compact binary snapshot of the current layout, or @c nil if the view is not loaded.
+ *
+ *  The snapshot holds the column sizes and pane widths the split view controller resolved, along with its bounds size, display mode, primary column grouping, snapped column and content offset. Store this data and pass it to @c -restoreLayoutFromSnapshot: on the next launch.
+ */
+- (nullable NSData *)layoutSnapshot;
+
+/**
+ *  Restores the layout of the split view controller from a snapshot.
+ *
+ *  Call this method after setting the @c viewControllers property and before the view appears. The first layout pass uses the column sizes and widths from the snapshot instead of querying the delegate, and the split view controller reconciles the layout with its delegate shortly after.
+ *
+ *  @param snapshot A snapshot returned by @c -layoutSnapshot.
+ *
+ *  @return @c YES if the snapshot was valid for the current view controllers, or @c NO if it was ignored.
+ */
+- (BOOL)restoreLayoutFromSnapshot:(NSData *)snapshot;
+
+/**
+ *  Returns the current memory and layer footprint of the split interface.
+ *
+ *  The footprint has an entry for each child view controller, with the cost of its content, its header and footer views and the chrome of its pane, and whether it is attached to its pane. It also has the cost of the split view itself. Views that aren't loaded are not loaded to measure them.
+ *
+ *  @note Measuring walks the whole layer tree. Use it for diagnostics and tests, not on every frame.
+ */
+- (MMSplitFootprint *)footprint;
+
 @end
 
 @interface MMSplitViewController (MMSplitViewControllerSubclassingHooks)
@@ -9,6 +9,42 @@
 #import "MMSplitViewController.h"
 #import "MMSplitPaneView.h"
 #import "MMSplitScrollView.h"
+#import "MMSplitLayoutSnapshot.h"
+#import "MMSplitEventStream.h"
+#import "MMSplitFootprint.h"
+#import "MMSplitReusePool.h"
+
+typedef struct {
+    BOOL valid;
+    UIUserInterfaceSizeClass horizontalSizeClass;
+    MMViewControllerDisplayMode preferredDisplayMode;
+    NSUInteger restoredDisplayMode;
+    NSUInteger inputsGeneration;
+    NSUInteger columnSizesHash;
+} MMSplitConfigurationFingerprint;
+
+NS_INLINE BOOL MMSplitConfigurationFingerprintEqualToFingerprint(MMSplitConfigurationFingerprint fingerprint, MMSplitConfigurationFingerprint otherFingerprint){
+    return (fingerprint.valid && otherFingerprint.valid &&
+            fingerprint.horizontalSizeClass == otherFingerprint.horizontalSizeClass &&
+            fingerprint.preferredDisplayMode == otherFingerprint.preferredDisplayMode &&
+            fingerprint.restoredDisplayMode == otherFingerprint.restoredDisplayMode &&
+            fingerprint.inputsGeneration == otherFingerprint.inputsGeneration &&
+            fingerprint.columnSizesHash == otherFingerprint.columnSizesHash);
+};
+
+typedef struct {
+    BOOL valid;
+    CGSize boundsSize;
+    MMViewControllerDisplayMode displayMode;
+    NSInteger snappedIndex;
+} MMSplitPublishedLayout;
+
+NS_INLINE BOOL MMSplitPublishedLayoutEqualToLayout(MMSplitPublishedLayout layout, MMSplitPublishedLayout otherLayout){
+    return (layout.valid && otherLayout.valid &&
+            CGSizeEqualToSize(layout.boundsSize, otherLayout.boundsSize) &&
+            layout.displayMode == otherLayout.displayMode &&
+            layout.snappedIndex == otherLayout.snappedIndex);
+};
 
 @interface MMSplitViewController () <MMSplitScrollViewDelegate> {
     struct {
@@ -18,7 +54,11 @@
         unsigned int delegateDidEndDisplayingViewController : 1;
         unsigned int delegateWillSnapToViewController : 1;
         unsigned int delegateDidSnapToViewController : 1;
+        unsigned int delegateDidExceedFootprintBudget : 1;
     } _delegateFlags;
+    
+    MMSplitConfigurationFingerprint _configurationFingerprint;
+    MMSplitPublishedLayout _publishedLayout;
 }
 
 @property (strong, nonatomic) MMSplitScrollView *scrollView;
@@ -26,13 +66,42 @@
 @property (strong, nonatomic) MMSplitPaneView *primaryCollapsedPane;
 @property (strong, nonatomic) NSMapTable <UIViewController *, MMSplitPaneView *> *panes;
 @property (copy, nonatomic) NSArray <UIViewController *> *primaryCollapsedViewControllers;
+@property (weak, nonatomic) UIViewController *pendingScrollViewController;
+@property (assign, nonatomic) BOOL pendingScrollAnimated;
+@property (assign, nonatomic, getter=isPendingScrollScheduled) BOOL pendingScrollScheduled;
+@property (strong, nonatomic) MMSplitLayoutSnapshot *restoredSnapshot;
+@property (strong, nonatomic) NSMapTable <UIViewController *, NSNumber *> *restoredColumnSizes;
+@property (assign, nonatomic, getter=isRestoredSnapshotApplied) BOOL restoredSnapshotApplied;
+@property (copy, nonatomic) NSData *columnWidthTable;
+@property (assign, nonatomic) MMSplitColumnSizingContext columnWidthTableContext;
+@property (assign, nonatomic) NSUInteger columnWidthTableInputsGeneration;
+@property (assign, nonatomic) NSUInteger columnSizingGeneration;
+@property (assign, nonatomic) NSUInteger configurationInputsGeneration;
+@property (assign, nonatomic) NSUInteger resolvedColumnSizesHash;
+@property (assign, nonatomic) NSUInteger resolvedColumnSizesGeneration;
+@property (assign, nonatomic, getter=areResolvedColumnSizesValid) BOOL resolvedColumnSizesValid;
+@property (assign, nonatomic) NSUInteger configurationChangesDepth;
+@property (assign, nonatomic) BOOL needsConfiguration;
+@property (assign, nonatomic) BOOL needsColumnSizeInvalidation;
+@property (copy, nonatomic) NSArray <MMSplitPaneView *> *columnPanes;
+@property (strong, nonatomic) NSMutableDictionary <NSNumber *, UIViewController *> *materializedViewControllers;
+@property (strong, nonatomic) NSMapTable <UIViewController *, NSNumber *> *indexesForMaterializedViewControllers;
+@property (assign, nonatomic, getter=isReleaseOfDistantViewControllersScheduled) BOOL releaseOfDistantViewControllersScheduled;
+@property (assign, nonatomic, getter=isFootprintBudgetCheckScheduled) BOOL footprintBudgetCheckScheduled;
+@property (assign, nonatomic, getter=isFootprintBudgetExceeded) BOOL footprintBudgetExceeded;
+@property (strong, nonatomic) NSMutableArray <MMSplitPaneView *> *panesPendingReuse;
+@property (assign, nonatomic, getter=isReuseOfPanesScheduled) BOOL reuseOfPanesScheduled;
 
 @end
 
 CGFloat const MMSplitViewControllerAutomaticDimension = CGFLOAT_MAX;
 
+static const NSUInteger MMSplitViewControllerMaterializedColumnMargin = 2;
+
 @implementation MMSplitViewController
 
+@synthesize viewControllers = _viewControllers;
+
 - (instancetype)initWithNibName:(NSString *)nibNameOrNil bundle:(NSBundle *)nibBundleOrNil
 {
     self = [super initWithNibName:nibNameOrNil bundle:nibBundleOrNil];
@@ -64,6 +133,9 @@ CGFloat const MMSplitViewControllerAutomaticDimension = CGFLOAT_MAX;
     // Storage:
     _panes = [NSMapTable strongToStrongObjectsMapTable];
     _viewControllers = @[];
+    _columnPanes = @[];
+    _materializedViewControllers = [NSMutableDictionary dictionary];
+    _indexesForMaterializedViewControllers = [NSMapTable strongToStrongObjectsMapTable];
 }
 
 - (MMSplitPaneView *)primaryCollapsedPane
@@ -82,6 +154,7 @@ CGFloat const MMSplitViewControllerAutomaticDimension = CGFLOAT_MAX;
         _primaryCollapsedScrollView.pagingEnabled = YES;
         _primaryCollapsedScrollView.alwaysBounceHorizontal = YES;
         _primaryCollapsedScrollView.overlayScreenCornersWhenBouncing = self.includesOpaqueRoundedCornersOverlay;
+        _primaryCollapsedScrollView.usesSharedChromeRenderer = self.usesSharedChromeRenderer;
         _primaryCollapsedScrollView.delegate = self;
     }
     return _primaryCollapsedScrollView;
@@ -94,6 +167,7 @@ CGFloat const MMSplitViewControllerAutomaticDimension = CGFLOAT_MAX;
         _scrollView.autoresizingMask = (UIViewAutoresizingFlexibleWidth | UIViewAutoresizingFlexibleHeight);
         _scrollView.alwaysBounceHorizontal = YES;
         _scrollView.overlayScreenCornersWhenBouncing = self.includesOpaqueRoundedCornersOverlay;
+        _scrollView.usesSharedChromeRenderer = self.usesSharedChromeRenderer;
         _scrollView.delegate = self;
     }
     return _scrollView;
@@ -110,6 +184,10 @@ CGFloat const MMSplitViewControllerAutomaticDimension = CGFLOAT_MAX;
         _delegateFlags.delegateDidEndDisplayingViewController = [delegate respondsToSelector:@selector(splitViewController:didEndDisplayingViewController:)];
         _delegateFlags.delegateWillSnapToViewController = [delegate respondsToSelector:@selector(splitViewController:willSnapToViewController:)];
         _delegateFlags.delegateDidSnapToViewController = [delegate respondsToSelector:@selector(splitViewController:didSnapToViewController:)];
+        _delegateFlags.delegateDidExceedFootprintBudget = [delegate respondsToSelector:@selector(splitViewController:didExceedFootprintBudgetWithFootprint:)];
+        
+        // Column sizes may differ with a new delegate:
+        self.configurationInputsGeneration += 1;
         
         if (self.isViewLoaded) {
             [self.scrollView invalidatePaneSizes];
@@ -180,23 +258,56 @@ CGFloat const MMSplitViewControllerAutomaticDimension = CGFLOAT_MAX;
     [self _configureScrollViewWithTraitCollection:self.traitCollection];
 }
 
+- (NSArray<UIViewController *> *)viewControllers
+{
+    if (self.dataSource != nil) {
+        NSArray <NSNumber *> *indexes = [self.materializedViewControllers.allKeys sortedArrayUsingSelector:@selector(compare:)];
+        
+        return [self.materializedViewControllers objectsForKeys:indexes notFoundMarker:[NSNull null]];
+    }
+    return _viewControllers;
+}
+
 - (void)setViewControllers:(NSArray<UIViewController *> *)viewControllers
 {
     if (!viewControllers) {
         viewControllers = @[];
     }
     
+    // Explicit view controllers replace the data source:
+    if (self.dataSource != nil) {
+        [self _endDisplayingVisibleColumns];
+        [self releaseMaterializedViewControllersOutsideRange:NSMakeRange(0, 0)];
+        
+        _dataSource = nil;
+        
+        [self _recyclePanesWhenUnused:self.columnPanes];
+        
+        self.columnPanes = @[];
+        self.configurationInputsGeneration += 1;
+        
+        [self _configureScrollViewWithTraitCollection:self.traitCollection];
+    }
+    
     if (![viewControllers isEqualToArray:_viewControllers]) {
         NSArray <UIViewController *> *previousViewControllers = _viewControllers;
+        NSMutableArray <MMSplitPaneView *> *removedPanes = [NSMutableArray array];
         
         for (UIViewController *viewController in previousViewControllers) {
             if (![viewControllers containsObject:viewController]) {
+                MMSplitPaneView *pane = [self.panes objectForKey:viewController];
+                if (pane) {
+                    [removedPanes addObject:pane];
+                }
+                
                 [viewController willMoveToParentViewController:nil];
                 [self.panes removeObjectForKey:viewController];
                 [viewController removeFromParentViewController];
             }
         }
         
+        [self _recyclePanesWhenUnused:removedPanes];
+        
         for (UIViewController *viewController in viewControllers) {
             if (viewController.parentViewController != self) {
                 [viewController willMoveToParentViewController:self];
@@ -205,6 +316,12 @@ CGFloat const MMSplitViewControllerAutomaticDimension = CGFLOAT_MAX;
         
         _viewControllers = [viewControllers copy];
         
+        self.configurationInputsGeneration += 1;
+        
+        // A restored snapshot only describes the stack it was restored for:
+        self.restoredSnapshot = nil;
+        self.restoredColumnSizes = nil;
+        
         for (UIViewController *viewController in viewControllers) {
             if (viewController.parentViewController != self) {
                 [self addChildViewController:viewController];
@@ -213,7 +330,7 @@ CGFloat const MMSplitViewControllerAutomaticDimension = CGFLOAT_MAX;
             
             MMSplitPaneView *pane = [self.panes objectForKey:viewController];
             if (!pane) {
-                pane = [[MMSplitPaneView alloc] init];
+                pane = [self _dequeuePane];
                 
                 if (viewController.isViewLoaded) {
                     pane.contentView = viewController.view;
@@ -273,6 +390,15 @@ CGFloat const MMSplitViewControllerAutomaticDimension = CGFLOAT_MAX;
 
 - (void)invalidateColumnSizes
 {
+    if (self.configurationChangesDepth > 0) {
+        self.needsColumnSizeInvalidation = YES;
+        return;
+    }
+    
+    self.configurationInputsGeneration += 1;
+    self.columnWidthTable = nil;
+    self.resolvedColumnSizesValid = NO;
+    
     if (!self.isViewLoaded) {
         return;
     }
@@ -281,7 +407,12 @@ CGFloat const MMSplitViewControllerAutomaticDimension = CGFLOAT_MAX;
         return;
     }
     
-    [self.scrollView invalidatePaneSizes];
+    // With a sizing provider, the pending layout waits for the table instead of solving on the main thread:
+    if (self.columnSizingProvider != nil) {
+        [self _scheduleColumnSizingForBoundsSize:self.scrollView.sizingBoundsSize];
+    } else {
+        [self.scrollView invalidatePaneSizes];
+    }
 }
 
 #pragma mark - Subclassing hooks.
@@ -296,6 +427,13 @@ CGFloat const MMSplitViewControllerAutomaticDimension = CGFLOAT_MAX;
     // Override point for subclasses.
 }
 
+- (void)willDisplayViewControllers:(NSArray <UIViewController *> *)viewControllers
+{
+    for (UIViewController *viewController in viewControllers) {
+        [self willDisplayViewController:viewController];
+    }
+}
+
 - (void)willSnapToViewController:(UIViewController *)viewController
 {
     // Override point for subclasses.
@@ -310,6 +448,23 @@ CGFloat const MMSplitViewControllerAutomaticDimension = CGFLOAT_MAX;
 
 - (void)_configureScrollViewWithTraitCollection:(UITraitCollection *)traitCollection transitionCoordinator:(id<UIViewControllerTransitionCoordinator>)coordinator
 {
+    // Defer until the outermost transaction commits:
+    if (self.configurationChangesDepth > 0) {
+        self.needsConfiguration = YES;
+        return;
+    }
+    
+    // Skip the pass if none of its inputs changed. Passes made before the view loads are never recorded, so -viewDidLoad always configures:
+    if (self.isViewLoaded) {
+        const MMSplitConfigurationFingerprint fingerprint = [self configurationFingerprintWithTraitCollection:traitCollection];
+        
+        if (MMSplitConfigurationFingerprintEqualToFingerprint(fingerprint, _configurationFingerprint)) {
+            return;
+        }
+        
+        _configurationFingerprint = fingerprint;
+    }
+    
     BOOL horizontallyCompact = traitCollection.horizontalSizeClass == UIUserInterfaceSizeClassCompact;
     BOOL pagingEnabled = horizontallyCompact;
     
@@ -317,10 +472,17 @@ CGFloat const MMSplitViewControllerAutomaticDimension = CGFLOAT_MAX;
         pagingEnabled = YES;
     }
     
+    // Until reconciled, trust the display mode of a restored snapshot:
+    if (self.restoredSnapshot && traitCollection.horizontalSizeClass == UIUserInterfaceSizeClassUnspecified) {
+        pagingEnabled = (self.restoredSnapshot.displayMode == MMViewControllerDisplayModeSinglePage);
+    }
+    
     // Check which panes to compress:
     NSMutableArray <UIViewController *> *primaryViewControllersForCompression = nil;
     
-    if (!pagingEnabled) {
+    const BOOL usesDataSource = (self.dataSource != nil);
+    
+    if (!pagingEnabled && !usesDataSource) {
         primaryViewControllersForCompression = [NSMutableArray arrayWithCapacity:self.viewControllers.count];
         
         for (UIViewController *viewController in self.viewControllers) {
@@ -348,16 +510,23 @@ CGFloat const MMSplitViewControllerAutomaticDimension = CGFLOAT_MAX;
         [panes addObject:self.primaryCollapsedPane];
     }
     
-    for (UIViewController *viewController in self.viewControllers) {
-        MMSplitPaneView *pane = [self.panes objectForKey:viewController];
-        
-        if ([primaryViewControllersForCompression containsObject:viewController]) {
-            [nestedPanes addObject:pane];
-        } else {
-            [panes addObject:pane];
+    if (usesDataSource) {
+        [panes addObjectsFromArray:self.columnPanes];
+    } else {
+        for (UIViewController *viewController in self.viewControllers) {
+            MMSplitPaneView *pane = [self.panes objectForKey:viewController];
+            
+            if ([primaryViewControllersForCompression containsObject:viewController]) {
+                [nestedPanes addObject:pane];
+            } else {
+                [panes addObject:pane];
+            }
         }
     }
     
+    // Widths resolved for the previous configuration no longer apply:
+    self.columnWidthTable = nil;
+    
     // Configure:
     self.primaryCollapsedScrollView.panes = nestedPanes;
     self.scrollView.panes = panes;
@@ -370,9 +539,88 @@ CGFloat const MMSplitViewControllerAutomaticDimension = CGFLOAT_MAX;
             [self.delegate splitViewController:self willChangeToDisplayMode:displayMode transitionCoordinator:coordinator];
         }
         
+        if (self.eventStream != nil) {
+            [self.eventStream publishEvent:(MMSplitEvent){
+                .type = MMSplitEventTypeWillChangeDisplayMode,
+                .displayMode = (uint8_t)displayMode,
+                .columnIndex = NSNotFound
+            }];
+        }
+        
         [self.scrollView setPagingEnabled:pagingEnabled];
         [self.scrollView invalidatePaneSizes];
     }
+    
+    if (self.isViewLoaded) {
+        [self _scheduleColumnSizingForBoundsSize:self.scrollView.sizingBoundsSize];
+    }
+}
+
+- (MMSplitConfigurationFingerprint)configurationFingerprintWithTraitCollection:(UITraitCollection *)traitCollection
+{
+    MMSplitLayoutSnapshot *restoredSnapshot = self.restoredSnapshot;
+    
+    return (MMSplitConfigurationFingerprint){
+        .valid = YES,
+        .horizontalSizeClass = traitCollection.horizontalSizeClass,
+        .preferredDisplayMode = self.preferredDisplayMode,
+        .restoredDisplayMode = (restoredSnapshot != nil) ? restoredSnapshot.displayMode : NSNotFound,
+        .inputsGeneration = self.configurationInputsGeneration,
+        .columnSizesHash = [self columnSizesHash]
+    };
+}
+
+- (NSUInteger)columnSizesHash
+{
+    // Columns of a data source are never grouped, so their sizes don't affect the configuration:
+    if (self.dataSource != nil) {
+        return 0;
+    }
+    
+    // Resolve the sizes once per set of inputs, not on every pass:
+    if (self.areResolvedColumnSizesValid && self.resolvedColumnSizesGeneration == self.configurationInputsGeneration) {
+        return self.resolvedColumnSizesHash;
+    }
+    
+    NSArray <UIViewController *> *viewControllers = self.viewControllers;
+    NSUInteger hash = viewControllers.count;
+    
+    for (UIViewController *viewController in viewControllers) {
+        hash = hash * 31 + [self columnSizeForViewController:viewController];
+    }
+    
+    self.resolvedColumnSizesHash = hash;
+    self.resolvedColumnSizesGeneration = self.configurationInputsGeneration;
+    self.resolvedColumnSizesValid = YES;
+    
+    return hash;
+}
+
+- (void)performConfigurationChanges:(void (NS_NOESCAPE ^)(void))changes
+{
+    self.configurationChangesDepth += 1;
+    
+    if (changes) {
+        changes();
+    }
+    
+    self.configurationChangesDepth -= 1;
+    
+    if (self.configurationChangesDepth > 0) {
+        return;
+    }
+    
+    if (self.needsConfiguration) {
+        self.needsConfiguration = NO;
+        
+        [self _configureScrollViewWithTraitCollection:self.traitCollection];
+    }
+    
+    if (self.needsColumnSizeInvalidation) {
+        self.needsColumnSizeInvalidation = NO;
+        
+        [self invalidateColumnSizes];
+    }
 }
 
 - (void)viewWillTransitionToSize:(CGSize)size withTransitionCoordinator:(id<UIViewControllerTransitionCoordinator>)coordinator
@@ -380,19 +628,26 @@ CGFloat const MMSplitViewControllerAutomaticDimension = CGFLOAT_MAX;
     [super viewWillTransitionToSize:size withTransitionCoordinator:coordinator];
     
     if (self.isViewLoaded) {
-        [self.scrollView invalidatePaneSizes];
+        [self.scrollView transitionToSize:size withTransitionCoordinator:coordinator];
     }
 }
 
 - (void)willTransitionToTraitCollection:(UITraitCollection *)newCollection withTransitionCoordinator:(id<UIViewControllerTransitionCoordinator>)coordinator
 {
     [super willTransitionToTraitCollection:newCollection withTransitionCoordinator:coordinator];
+    
+    // The delegate may size columns differently for the new traits:
+    self.resolvedColumnSizesValid = NO;
+    
     [self _configureScrollViewWithTraitCollection:newCollection transitionCoordinator:coordinator];
 }
 
 - (void)traitCollectionDidChange:(UITraitCollection *)previousTraitCollection
 {
     [super traitCollectionDidChange:previousTraitCollection];
+    
+    self.resolvedColumnSizesValid = NO;
+    
     [self _configureScrollViewWithTraitCollection:self.traitCollection];
 }
 
@@ -404,15 +659,18 @@ CGFloat const MMSplitViewControllerAutomaticDimension = CGFLOAT_MAX;
     NSArray <UIViewController *> *storage = nil;
     
     if (scrollView == self.scrollView) {
+        if (self.dataSource != nil) {
+            return (page >= 0) ? [self materializeViewControllerForColumnAtIndex:page] : nil;
+        }
+        
         storage = self.viewControllers;
         
         if (self.primaryCollapsedViewControllers.count > 0) {
             if (page == 0) {
-                const auto NSIndexSet *visibleCollapsedIndexes = self.primaryCollapsedScrollView.indexesForVisiblePanes;
+                const NSRange visibleCollapsedRange = self.primaryCollapsedScrollView.rangeForVisiblePanes;
                 
-                if (visibleCollapsedIndexes.count > 0) {
-                    const NSUInteger firstIndex = visibleCollapsedIndexes.firstIndex;
-                    return self.primaryCollapsedViewControllers[firstIndex];
+                if (visibleCollapsedRange.length > 0 && visibleCollapsedRange.location < self.primaryCollapsedViewControllers.count) {
+                    return self.primaryCollapsedViewControllers[visibleCollapsedRange.location];
                 }
                 return nil;
             }
@@ -429,9 +687,26 @@ CGFloat const MMSplitViewControllerAutomaticDimension = CGFLOAT_MAX;
     return nil;
 }
 
+- (MMViewControllerColumnSize)columnSizeForPage:(NSInteger)page inScrollView:(MMSplitScrollView *)scrollView
+{
+    // Don't instantiate view controllers just to size their columns:
+    if (self.dataSource != nil && scrollView == self.scrollView) {
+        if (page >= 0 && page < (NSInteger)self.columnPanes.count) {
+            return [self.dataSource splitViewController:self columnSizeForColumnAtIndex:page];
+        }
+        return MMViewControllerColumnSizeDefault;
+    }
+    return [self columnSizeForViewController:[self viewControllerForPage:page inScrollView:scrollView]];
+}
+
 - (MMViewControllerColumnSize)columnSizeForViewController:(UIViewController *)viewController
 {
     if (viewController != nil) {
+        NSNumber *restoredColumnSize = [self.restoredColumnSizes objectForKey:viewController];
+        if (restoredColumnSize != nil) {
+            return restoredColumnSize.unsignedIntegerValue;
+        }
+        
         if (_delegateFlags.delegateColumnSizeForViewController) {
             return [self.delegate splitViewController:self columnSizeForViewController:viewController];
         }
@@ -449,6 +724,11 @@ NS_INLINE CGFloat MMSplitDimensionUsingDefaultValue(CGFloat value, CGFloat defau
 {
     const CGSize boundsSize = self.isViewLoaded ? self.view.bounds.size : CGSizeZero;
     
+    return [self primaryColumnWidthForBoundsSize:boundsSize];
+}
+
+- (CGFloat)primaryColumnWidthForBoundsSize:(CGSize)boundsSize
+{
     const CGFloat preferredPrimaryColumnWidthFraction = MMSplitDimensionUsingDefaultValue(self.preferredPrimaryColumnWidthFraction, 0.38f);
     const CGFloat minimumPrimaryColumnWidth = MMSplitDimensionUsingDefaultValue(self.minimumPrimaryColumnWidth, 320.0f);
     const CGFloat maximumPrimaryColumnWidth = MMSplitDimensionUsingDefaultValue(self.maximumPrimaryColumnWidth, 400.0f);
@@ -477,220 +757,1035 @@ NS_INLINE CGFloat MMSplitDimensionUsingDefaultValue(CGFloat value, CGFloat defau
     return MMSplitDimensionUsingDefaultValue(self.minimumSecondaryColumnWidth, 410.0f);
 }
 
-#pragma mark - <MMSplitScrollViewDelegate>
-
-- (void)scrollView:(MMSplitScrollView *)scrollView willDisplayView:(UIView *)view atPage:(NSInteger)page
+- (MMSplitColumnSizingContext)columnSizingContextForBoundsSize:(CGSize)boundsSize
 {
-    UIViewController *viewController = [self viewControllerForPage:page inScrollView:scrollView];
+    UIEdgeInsets safeAreaInsets = UIEdgeInsetsZero;
     
-    if (viewController != nil) {
-        if (_delegateFlags.delegateWillDisplayViewController) {
-            [self.delegate splitViewController:self willDisplayViewController:viewController];
-        }
-        
-        [self willDisplayViewController:viewController];
-        
-        MMSplitPaneView *paneView = (MMSplitPaneView *)view;
-        
-        [viewController beginAppearanceTransition:YES animated:(scrollView.isDecelerating || scrollView.isTracking)];
-        
-        const BOOL configuresContentViewForViewController = (view != self.primaryCollapsedPane);
-        
-        if (configuresContentViewForViewController) {
-            if (!paneView.contentView) {
-                paneView.contentView = viewController.view;
-            }
+#if __IPHONE_OS_VERSION_MAX_ALLOWED >= 110000
+    if (@available(iOS 11.0, *)) {
+        if (self.isViewLoaded) {
+            safeAreaInsets = self.view.safeAreaInsets;
         }
-        
-        [viewController endAppearanceTransition];
     }
-}
-
-- (void)scrollView:(MMSplitScrollView *)scrollView didEndDisplayingView:(UIView *)view atPage:(NSInteger)page
-{
-    UIViewController *viewController = [self viewControllerForPage:page inScrollView:scrollView];
+#endif
     
-    if (viewController != nil) {
-        MMSplitPaneView *paneView = (MMSplitPaneView *)view;
-        
-        [viewController beginAppearanceTransition:NO animated:(scrollView.isDecelerating || scrollView.isTracking)];
-        
-        const BOOL configuresContentViewForViewController = (view != self.primaryCollapsedPane);
-        
-        if (configuresContentViewForViewController) {
-            paneView.contentView = nil;
-        }
-        
-        [viewController endAppearanceTransition];
-        
-        if (_delegateFlags.delegateDidEndDisplayingViewController) {
-            [self.delegate splitViewController:self didEndDisplayingViewController:viewController];
-        }
-    }
+    return (MMSplitColumnSizingContext){
+        .boundsSize = boundsSize,
+        .safeAreaInsets = safeAreaInsets,
+        .primaryColumnWidth = [self primaryColumnWidthForBoundsSize:boundsSize],
+        .minimumPrimaryColumnWidth = MMSplitDimensionUsingDefaultValue(self.minimumPrimaryColumnWidth, 320.0f),
+        .maximumPrimaryColumnWidth = MMSplitDimensionUsingDefaultValue(self.maximumPrimaryColumnWidth, 400.0f),
+        .minimumSecondaryColumnWidth = self.actualMinimumSecondaryColumnWidth,
+        .horizontallyCompact = (self.traitCollection.horizontalSizeClass == UIUserInterfaceSizeClassCompact)
+    };
 }
 
-- (CGSize)scrollView:(MMSplitScrollView *)scrollView sizeForView:(MMSplitPaneView *)view atPage:(NSInteger)page
+CGFloat MMSplitColumnWidthForColumnSize(MMViewControllerColumnSize columnSize, MMViewControllerColumnSize followingColumnSize, MMSplitColumnSizingContext context)
 {
-    const auto UIViewController *viewController = [self viewControllerForPage:page inScrollView:scrollView];
-    const MMViewControllerColumnSize columnSize = [self columnSizeForViewController:(UIViewController *)viewController];
-    
-    const CGRect bounds = self.view.bounds;
+    const CGFloat boundsWidth = context.boundsSize.width;
     
-    // Just return bounds size if fullscreen:
-    if (columnSize == MMViewControllerColumnSizeFullscreen) {
-        return bounds.size;
+    // Just return bounds width if fullscreen or paging:
+    if (columnSize == MMViewControllerColumnSizeFullscreen || context.horizontallyCompact) {
+        return boundsWidth;
     }
     
-    const CGFloat widthForPrimaryColumn = self.primaryColumnWidth;
+    const CGFloat widthForPrimaryColumn = context.primaryColumnWidth;
     
-    // Determine whatever paging should be enabled:
-    UITraitCollection *traitCollection = self.traitCollection;
-    BOOL pagingEnabled = (traitCollection.horizontalSizeClass == UIUserInterfaceSizeClassCompact);
+    if (columnSize == MMViewControllerColumnSizePrimary || columnSize == MMViewControllerColumnSizeAuxiliary) {
+        return widthForPrimaryColumn;
     
-    if (!pagingEnabled) {
-        if (columnSize == MMViewControllerColumnSizePrimary || columnSize == MMViewControllerColumnSizeAuxiliary) {
-            return (CGSize){ widthForPrimaryColumn, CGRectGetHeight(bounds) };
-            
-        } else if (columnSize == MMViewControllerColumnSizeSecondary) {
-            const CGFloat minimumSecondaryColumnWidth = self.actualMinimumSecondaryColumnWidth;
-            const CGFloat maximumWidthForSecondaryColumn = CGRectGetWidth(bounds) - widthForPrimaryColumn;
-            
-            const BOOL containsAuxiliaryColumn = [self columnSizeForViewController:[self viewControllerForPage:(page + 1) inScrollView:scrollView]] == MMViewControllerColumnSizeAuxiliary;
-            
-            CGFloat secondaryColumnWidth = maximumWidthForSecondaryColumn;
-            
-            if (containsAuxiliaryColumn) {
-                const CGFloat proposedAdjustingForAuxiliaryColumn = (maximumWidthForSecondaryColumn - widthForPrimaryColumn);
-                if (proposedAdjustingForAuxiliaryColumn > minimumSecondaryColumnWidth) {
-                    secondaryColumnWidth = proposedAdjustingForAuxiliaryColumn;
-                }
-            }
-            
-            if (secondaryColumnWidth > minimumSecondaryColumnWidth) {
-                return (CGSize){ secondaryColumnWidth, CGRectGetHeight(bounds) };
+    } else if (columnSize == MMViewControllerColumnSizeSecondary) {
+        const CGFloat minimumSecondaryColumnWidth = context.minimumSecondaryColumnWidth;
+        const CGFloat maximumWidthForSecondaryColumn = boundsWidth - widthForPrimaryColumn;
+        
+        CGFloat secondaryColumnWidth = maximumWidthForSecondaryColumn;
+        
+        if (followingColumnSize == MMViewControllerColumnSizeAuxiliary) {
+            const CGFloat proposedAdjustingForAuxiliaryColumn = (maximumWidthForSecondaryColumn - widthForPrimaryColumn);
+            if (proposedAdjustingForAuxiliaryColumn > minimumSecondaryColumnWidth) {
+                secondaryColumnWidth = proposedAdjustingForAuxiliaryColumn;
             }
         }
+        
+        if (secondaryColumnWidth > minimumSecondaryColumnWidth) {
+            return secondaryColumnWidth;
+        }
     }
     
-    return bounds.size;
+    return boundsWidth;
 }
 
-- (void)scrollView:(MMSplitScrollView *)scrollView willSnapToView:(UIView *)view atPage:(NSInteger)page
+NS_INLINE void MMSplitSolveColumnWidths(const MMViewControllerColumnSize *columnSizes, NSUInteger count, MMSplitColumnSizingContext context, id <MMSplitColumnSizingProvider> provider, CGFloat *widths){
+    // Compact widths never get here, the scroll view pages instead. Pick the policy once, then resolve every column in a single pass:
+    if (provider != nil) {
+        for (NSUInteger idx = 0; idx < count; idx++) {
+            const MMViewControllerColumnSize followingColumnSize = (idx + 1 < count) ? columnSizes[idx + 1] : MMViewControllerColumnSizeDefault;
+            widths[idx] = [provider widthForColumnSize:columnSizes[idx] followingColumnSize:followingColumnSize context:context];
+        }
+    } else {
+        for (NSUInteger idx = 0; idx < count; idx++) {
+            const MMViewControllerColumnSize followingColumnSize = (idx + 1 < count) ? columnSizes[idx + 1] : MMViewControllerColumnSizeDefault;
+            widths[idx] = MMSplitColumnWidthForColumnSize(columnSizes[idx], followingColumnSize, context);
+        }
+    }
+};
+
+- (NSData *)columnSizesForPagesInScrollView:(MMSplitScrollView *)scrollView
 {
-    UIViewController *viewController = [self viewControllerForPage:page inScrollView:scrollView];
+    const NSUInteger numberOfPages = scrollView.panes.count;
     
-    [self willSnapToViewController:viewController];
+    NSMutableData *data = [NSMutableData dataWithLength:numberOfPages * sizeof(MMViewControllerColumnSize)];
+    MMViewControllerColumnSize *columnSizes = data.mutableBytes;
     
-    if (_delegateFlags.delegateWillSnapToViewController) {
-        [self.delegate splitViewController:self willSnapToViewController:viewController];
+    for (NSUInteger page = 0; page < numberOfPages; page++) {
+        columnSizes[page] = [self columnSizeForPage:page inScrollView:scrollView];
     }
+    
+    return data;
 }
 
-- (void)scrollView:(MMSplitScrollView *)scrollView didSnapToView:(UIView *)view atPage:(NSInteger)page
+#pragma mark - Event streams.
+
+- (void)setEventStream:(MMSplitEventStream *)eventStream
 {
-    if (_delegateFlags.delegateDidSnapToViewController) {
-        UIViewController *viewController = [self viewControllerForPage:page inScrollView:scrollView];
+    if (eventStream != _eventStream) {
+        _eventStream = eventStream;
+        
+        // A new stream starts with the current layout:
+        _publishedLayout.valid = NO;
         
-        [self.delegate splitViewController:self didSnapToViewController:viewController];
+        if (self.isViewLoaded) {
+            [self.view setNeedsLayout];
+        }
     }
 }
 
-#pragma mark - <UIScrollViewDelegate>
+#pragma mark - Column sizing providers.
 
-- (void)scrollViewDidScroll:(UIScrollView *)scrollView
+- (void)setColumnSizingProvider:(id<MMSplitColumnSizingProvider>)columnSizingProvider
 {
-    static BOOL invalidateSafeAreaInvocationNeeded;
-    static SEL invalidateSafeAreaSelector;
-    static dispatch_once_t onceToken;
-    dispatch_once(&onceToken, ^{
-        NSString *invalidateSafeAreaSelectorString = [@[ @"_updateCont", @"entOverlayInsetsF", @"orSelfAndChildren" ] componentsJoinedByString:@""];
-
-        invalidateSafeAreaSelector = NSSelectorFromString(invalidateSafeAreaSelectorString);
-        invalidateSafeAreaInvocationNeeded = [UIScrollView instancesRespondToSelector:@selector(safeAreaInsets)] && [self respondsToSelector:invalidateSafeAreaSelector];
-    });
-
-    if (invalidateSafeAreaInvocationNeeded) {
-#pragma clang diagnostic push
-#pragma clang diagnostic ignored "-Warc-performSelector-leaks"
-        [self performSelector:invalidateSafeAreaSelector];
-#pragma clang diagnostic pop
+    if (columnSizingProvider != _columnSizingProvider) {
+        _columnSizingProvider = columnSizingProvider;
+        
+        // Widths from a previous provider no longer apply:
+        self.columnWidthTable = nil;
+        self.columnSizingGeneration += 1;
+        
+        [self invalidateColumnSizes];
     }
 }
 
-#pragma mark - Showing view controllers:
-
-- (UIViewController *)targetViewControllerForAction:(SEL)action sender:(id)sender
+- (CGFloat)widthForColumnSize:(MMViewControllerColumnSize)columnSize followingColumnSize:(MMViewControllerColumnSize)followingColumnSize context:(MMSplitColumnSizingContext)context
 {
-    if (action == @selector(showViewController:sender:)) {
-        return self;
+    id <MMSplitColumnSizingProvider> columnSizingProvider = self.columnSizingProvider;
+    if (columnSizingProvider != nil) {
+        return [columnSizingProvider widthForColumnSize:columnSize followingColumnSize:followingColumnSize context:context];
     }
-    return [super targetViewControllerForAction:action sender:sender];
+    return MMSplitColumnWidthForColumnSize(columnSize, followingColumnSize, context);
 }
 
-- (void)showViewController:(UIViewController *)vc sender:(id)sender
+NS_INLINE BOOL MMSplitColumnSizingContextEqualToContext(MMSplitColumnSizingContext context, MMSplitColumnSizingContext otherContext){
+    return (CGSizeEqualToSize(context.boundsSize, otherContext.boundsSize) &&
+            UIEdgeInsetsEqualToEdgeInsets(context.safeAreaInsets, otherContext.safeAreaInsets) &&
+            context.primaryColumnWidth == otherContext.primaryColumnWidth &&
+            context.minimumPrimaryColumnWidth == otherContext.minimumPrimaryColumnWidth &&
+            context.maximumPrimaryColumnWidth == otherContext.maximumPrimaryColumnWidth &&
+            context.minimumSecondaryColumnWidth == otherContext.minimumSecondaryColumnWidth &&
+            context.horizontallyCompact == otherContext.horizontallyCompact);
+};
+
+- (void)_scheduleColumnSizingForBoundsSize:(CGSize)boundsSize
 {
-    if (!vc) {
+    id <MMSplitColumnSizingProvider> columnSizingProvider = self.columnSizingProvider;
+    if (columnSizingProvider == nil || CGSizeEqualToSize(boundsSize, CGSizeZero)) {
         return;
     }
     
-    if (![self.viewControllers containsObject:vc]) {
-        self.viewControllers = [self.viewControllers arrayByAddingObject:vc];
+    const MMSplitColumnSizingContext context = [self columnSizingContextForBoundsSize:boundsSize];
+    const NSUInteger inputsGeneration = self.configurationInputsGeneration;
+    
+    // Nothing to do if a layout pass already solved these inputs on the main thread:
+    if ([self _columnWidthTableMatchesContext:context inputsGeneration:inputsGeneration count:self.scrollView.panes.count]) {
+        return;
     }
     
-    [self scrollToViewController:vc animated:YES];
+    // Column sizes come from the delegate, so resolve them here:
+    NSData *columnSizes = [self columnSizesForPagesInScrollView:self.scrollView];
+    
+    const NSUInteger numberOfPages = columnSizes.length / sizeof(MMViewControllerColumnSize);
+    const NSUInteger generation = ++self.columnSizingGeneration;
+    
+    __weak typeof(self) weakSelf = self;
+    
+    dispatch_async(dispatch_get_global_queue(QOS_CLASS_USER_INITIATED, 0), ^{
+        NSMutableData *widths = [NSMutableData dataWithLength:numberOfPages * sizeof(CGFloat)];
+        
+        MMSplitSolveColumnWidths(columnSizes.bytes, numberOfPages, context, columnSizingProvider, widths.mutableBytes);
+        
+        dispatch_async(dispatch_get_main_queue(), ^{
+            [weakSelf _commitColumnWidthTable:widths context:context inputsGeneration:inputsGeneration generation:generation];
+        });
+    });
 }
 
-- (void)scrollToViewController:(UIViewController *)viewController animated:(BOOL)animated
+- (void)_commitColumnWidthTable:(NSData *)widths context:(MMSplitColumnSizingContext)context inputsGeneration:(NSUInteger)inputsGeneration generation:(NSUInteger)generation
 {
-    if (![self.viewControllers containsObject:viewController]) {
+    // Drop results superseded by a newer request, or by inputs that changed meanwhile:
+    if (generation != self.columnSizingGeneration || inputsGeneration != self.configurationInputsGeneration) {
         return;
     }
     
-    if ([self.primaryCollapsedViewControllers containsObject:viewController]) {
-        const NSInteger idx = [self.primaryCollapsedViewControllers indexOfObject:viewController];
-        
-        // First, scroll the primary collapsed pane into view:
-        [self.scrollView scrollToPane:self.primaryCollapsedPane animated:animated];
-        
-        // Actually scroll to the view controller's pane:
-        [self.primaryCollapsedScrollView scrollToPane:self.primaryCollapsedScrollView.panes[idx] animated:animated];
+    // A layout pass may have solved the same inputs on the main thread meanwhile:
+    const NSUInteger count = widths.length / sizeof(CGFloat);
+    
+    if ([self _columnWidthTableMatchesContext:context inputsGeneration:inputsGeneration count:count] && [self.columnWidthTable isEqualToData:widths]) {
         return;
     }
     
-    NSInteger page = [self.viewControllers indexOfObject:viewController];
+    self.columnWidthTable = widths;
+    self.columnWidthTableContext = context;
+    self.columnWidthTableInputsGeneration = inputsGeneration;
     
-    if (self.primaryCollapsedViewControllers.count > 0) {
-        page = page - (self.primaryCollapsedViewControllers.count - 1);
+    // The whole table is swapped in on the next layout pass:
+    [self.scrollView invalidatePaneSizes];
+}
+
+- (BOOL)_columnWidthTableMatchesContext:(MMSplitColumnSizingContext)context inputsGeneration:(NSUInteger)inputsGeneration count:(NSUInteger)count
+{
+    NSData *columnWidthTable = self.columnWidthTable;
+    
+    if (columnWidthTable == nil || columnWidthTable.length != count * sizeof(CGFloat)) {
+        return NO;
     }
     
-    [self.scrollView scrollToPane:self.scrollView.panes[page] animated:animated];
+    return (self.columnWidthTableInputsGeneration == inputsGeneration && MMSplitColumnSizingContextEqualToContext(self.columnWidthTableContext, context));
 }
 
-- (BOOL)canToggleVisibilityForViewController:(UIViewController *)viewController
+- (BOOL)hasPrecomputedWidthsForScrollView:(MMSplitScrollView *)scrollView
 {
-    if (![self.viewControllers containsObject:viewController]) {
+    if (self.columnWidthTable == nil || scrollView != self.scrollView) {
         return NO;
     }
     
-    if (self.displayMode == MMViewControllerDisplayModeSinglePage) {
-        return (viewController != self.viewControllers.firstObject);
-    }
+    const MMSplitColumnSizingContext context = [self columnSizingContextForBoundsSize:scrollView.sizingBoundsSize];
     
-    if ([self.primaryCollapsedViewControllers containsObject:viewController]) {
-        return YES;
+    return [self _columnWidthTableMatchesContext:context inputsGeneration:self.configurationInputsGeneration count:scrollView.panes.count];
+}
+
+- (CGFloat)precomputedWidthForPage:(NSInteger)page inScrollView:(MMSplitScrollView *)scrollView
+{
+    if (![self hasPrecomputedWidthsForScrollView:scrollView] || page < 0 || page >= (NSInteger)scrollView.panes.count) {
+        return -1.0f;
     }
     
-    UIView *pane = [self.panes objectForKey:viewController];
-    MMSplitScrollView *scrollView = self.scrollView;
-    
-    const CGRect paneRect = [scrollView rectForPane:pane];
-    const CGFloat maximumContentOffsetX = -(scrollView.contentSize.width - CGRectGetWidth(scrollView.bounds));
-    const BOOL scrollingPastPaneIsPossible = -CGRectGetMinX(paneRect) >= maximumContentOffsetX;
+    const CGFloat *widths = self.columnWidthTable.bytes;
     
-    return (scrollingPastPaneIsPossible);
+    return widths[page];
 }
 
-- (void)setIncludesOpaqueRoundedCornersOverlay:(BOOL)flag
+#pragma mark - Layout snapshots.
+
+- (void)setRestoredColumnSizes:(NSMapTable<UIViewController *,NSNumber *> *)restoredColumnSizes
+{
+    if (restoredColumnSizes != _restoredColumnSizes) {
+        _restoredColumnSizes = restoredColumnSizes;
+        
+        // Restored column sizes take precedence over the delegate:
+        self.configurationInputsGeneration += 1;
+    }
+}
+
+- (NSData *)layoutSnapshot
+{
+    if (!self.isViewLoaded || self.dataSource != nil) {
+        return nil;
+    }
+    
+    MMSplitScrollView *scrollView = self.scrollView;
+    NSArray <UIViewController *> *viewControllers = self.viewControllers;
+    
+    NSMutableArray <NSNumber *> *columnSizes = [NSMutableArray arrayWithCapacity:viewControllers.count];
+    for (UIViewController *viewController in viewControllers) {
+        [columnSizes addObject:@([self columnSizeForViewController:viewController])];
+    }
+    
+    NSMutableArray <NSNumber *> *paneWidths = [NSMutableArray arrayWithCapacity:scrollView.panes.count];
+    for (UIView *pane in scrollView.panes) {
+        [paneWidths addObject:@(CGRectGetWidth([scrollView rectForPane:pane]))];
+    }
+    
+    const NSRange visibleRange = scrollView.rangeForVisiblePanes;
+    
+    MMSplitLayoutSnapshot *snapshot = [[MMSplitLayoutSnapshot alloc] init];
+    snapshot.displayMode = self.displayMode;
+    snapshot.boundsSize = scrollView.bounds.size;
+    snapshot.contentOffset = scrollView.contentOffset;
+    snapshot.snappedIndex = (visibleRange.length > 0) ? visibleRange.location : NSNotFound;
+    snapshot.primaryCollapsedCount = self.primaryCollapsedViewControllers.count;
+    snapshot.columnSizes = columnSizes;
+    snapshot.paneWidths = paneWidths;
+    
+    return snapshot.dataRepresentation;
+}
+
+- (BOOL)restoreLayoutFromSnapshot:(NSData *)data
+{
+    MMSplitLayoutSnapshot *snapshot = (data != nil) ? [[MMSplitLayoutSnapshot alloc] initWithData:data] : nil;
+    NSArray <UIViewController *> *viewControllers = self.viewControllers;
+    
+    if (!snapshot || snapshot.columnSizes.count != viewControllers.count || self.dataSource != nil) {
+        return NO;
+    }
+    
+    NSMapTable <UIViewController *, NSNumber *> *restoredColumnSizes = [NSMapTable weakToStrongObjectsMapTable];
+    
+    [viewControllers enumerateObjectsUsingBlock:^(UIViewController *viewController, NSUInteger idx, BOOL *stop) {
+        [restoredColumnSizes setObject:snapshot.columnSizes[idx] forKey:viewController];
+    }];
+    
+    self.restoredSnapshot = snapshot;
+    self.restoredColumnSizes = restoredColumnSizes;
+    self.restoredSnapshotApplied = NO;
+    
+    if (self.isViewLoaded) {
+        [self _configureScrollViewWithTraitCollection:self.traitCollection];
+        [self.scrollView invalidatePaneSizes];
+    }
+    
+    return YES;
+}
+
+- (CGFloat)restoredWidthForPage:(NSInteger)page inScrollView:(MMSplitScrollView *)scrollView
+{
+    MMSplitLayoutSnapshot *snapshot = self.restoredSnapshot;
+    
+    if (!snapshot || scrollView != self.scrollView) {
+        return -1.0f;
+    }
+    
+    // Only use the snapshot while sizing for its bounds (or before the view is sized at all):
+    const CGSize sizingBoundsSize = scrollView.sizingBoundsSize;
+    const BOOL matchesSnapshot = CGSizeEqualToSize(sizingBoundsSize, snapshot.boundsSize) || CGSizeEqualToSize(sizingBoundsSize, CGSizeZero);
+    
+    if (!matchesSnapshot || page < 0 || page >= (NSInteger)snapshot.paneWidths.count) {
+        return -1.0f;
+    }
+    
+    return (CGFloat)snapshot.paneWidths[page].doubleValue;
+}
+
+- (void)viewDidLayoutSubviews
+{
+    [super viewDidLayoutSubviews];
+    
+    if (self.eventStream != nil) {
+        MMSplitScrollView *scrollView = self.scrollView;
+        
+        // Layout runs on every scrolled frame; only publish when the resolved layout changes:
+        const MMSplitPublishedLayout layout = (MMSplitPublishedLayout){
+            .valid = YES,
+            .boundsSize = scrollView.bounds.size,
+            .displayMode = self.displayMode,
+            .snappedIndex = scrollView.snappedPaneIndex
+        };
+        
+        if (!MMSplitPublishedLayoutEqualToLayout(layout, _publishedLayout)) {
+            _publishedLayout = layout;
+            
+            [self.eventStream publishEvent:(MMSplitEvent){
+                .type = MMSplitEventTypeLayout,
+                .displayMode = (uint8_t)layout.displayMode,
+                .columnIndex = NSNotFound,
+                .boundsSize = layout.boundsSize,
+                .contentOffset = scrollView.contentOffset
+            }];
+        }
+    }
+    
+    MMSplitLayoutSnapshot *snapshot = self.restoredSnapshot;
+    
+    if (!snapshot || self.isRestoredSnapshotApplied) {
+        return;
+    }
+    
+    self.restoredSnapshotApplied = YES;
+    
+    MMSplitScrollView *scrollView = self.scrollView;
+    
+    if (CGSizeEqualToSize(scrollView.bounds.size, snapshot.boundsSize)) {
+        const CGFloat maximumContentOffsetX = MAX(scrollView.contentSize.width - CGRectGetWidth(scrollView.bounds), 0.0f);
+        
+        scrollView.contentOffset = (CGPoint){ MAX(MIN(snapshot.contentOffset.x, maximumContentOffsetX), 0.0f), 0.0f };
+    }
+    
+    // Reconcile with the delegate once the first frame is on screen:
+    __weak typeof(self) weakSelf = self;
+    
+    dispatch_async(dispatch_get_main_queue(), ^{
+        [weakSelf _reconcileRestoredSnapshot:snapshot];
+    });
+}
+
+- (void)_reconcileRestoredSnapshot:(MMSplitLayoutSnapshot *)snapshot
+{
+    if (snapshot != self.restoredSnapshot) {
+        return;
+    }
+    
+    self.restoredSnapshot = nil;
+    self.restoredColumnSizes = nil;
+    
+    [self _configureScrollViewWithTraitCollection:self.traitCollection];
+    [self.scrollView invalidatePaneSizes];
+}
+
+#pragma mark - Event stream.
+
+- (void)publishEventOfType:(MMSplitEventType)type forViewController:(UIViewController *)viewController
+{
+    MMSplitEventStream *eventStream = self.eventStream;
+    
+    if (eventStream == nil || viewController == nil) {
+        return;
+    }
+    
+    [eventStream publishEvent:(MMSplitEvent){
+        .type = type,
+        .displayMode = (uint8_t)self.displayMode,
+        .columnIndex = [self indexOfColumnForViewController:viewController]
+    }];
+}
+
+#pragma mark - Footprint.
+
+- (MMSplitFootprint *)footprint
+{
+    MMSplitFootprint *footprint = [[MMSplitFootprint alloc] init];
+    
+    if (!self.isViewLoaded) {
+        return footprint;
+    }
+    
+    NSArray <UIViewController *> *viewControllers = self.viewControllers;
+    NSMutableArray <MMSplitPaneFootprint *> *paneFootprints = [NSMutableArray arrayWithCapacity:viewControllers.count];
+    NSMutableSet <CALayer *> *paneLayers = [NSMutableSet setWithCapacity:viewControllers.count];
+    
+    for (UIViewController *viewController in viewControllers) {
+        MMSplitPaneView *paneView = [self.panes objectForKey:viewController];
+        
+        [paneFootprints addObject:[MMSplitPaneFootprint footprintForViewController:viewController paneView:paneView]];
+        
+        if (paneView != nil) {
+            [paneLayers addObject:paneView.layer];
+        }
+    }
+    
+    // The panes are measured on their own, the rest of the view belongs to the split view:
+    footprint.paneFootprints = paneFootprints;
+    footprint.splitFootprint = MMSplitLayerFootprintForLayerTree(self.view.layer, paneLayers);
+    
+    return footprint;
+}
+
+- (void)setFootprintBudget:(uint64_t)footprintBudget
+{
+    if (footprintBudget != _footprintBudget) {
+        _footprintBudget = footprintBudget;
+        
+        self.footprintBudgetExceeded = NO;
+        
+        [self _scheduleFootprintBudgetCheck];
+    }
+}
+
+- (void)_scheduleFootprintBudgetCheck
+{
+    if (self.footprintBudget == 0 || !_delegateFlags.delegateDidExceedFootprintBudget || self.isFootprintBudgetCheckScheduled) {
+        return;
+    }
+    
+    self.footprintBudgetCheckScheduled = YES;
+    
+    // Measure once the current batch of changes settles:
+    __weak typeof(self) weakSelf = self;
+    
+    dispatch_async(dispatch_get_main_queue(), ^{
+        [weakSelf _checkFootprintBudget];
+    });
+}
+
+- (void)_checkFootprintBudget
+{
+    self.footprintBudgetCheckScheduled = NO;
+    
+    const uint64_t footprintBudget = self.footprintBudget;
+    
+    if (footprintBudget == 0 || !_delegateFlags.delegateDidExceedFootprintBudget) {
+        return;
+    }
+    
+    MMSplitFootprint *footprint = [self footprint];
+    
+    const BOOL exceeded = (footprint.totalFootprint.backingStoreBytes > footprintBudget);
+    const BOOL notifies = (exceeded && !self.isFootprintBudgetExceeded);
+    
+    self.footprintBudgetExceeded = exceeded;
+    
+    if (notifies) {
+        [self.delegate splitViewController:self didExceedFootprintBudgetWithFootprint:footprint];
+    }
+}
+
+#pragma mark - Pane reuse.
+
+- (MMSplitPaneView *)_dequeuePane
+{
+    return [[MMSplitReusePool sharedPool] dequeueViewOfClass:[MMSplitPaneView class]] ?: [[MMSplitPaneView alloc] init];
+}
+
+- (void)_recyclePanesWhenUnused:(NSArray <MMSplitPaneView *> *)panes
+{
+    if (panes.count == 0) {
+        return;
+    }
+    
+    if (!self.panesPendingReuse) {
+        self.panesPendingReuse = [NSMutableArray array];
+    }
+    
+    [self.panesPendingReuse addObjectsFromArray:panes];
+    
+    if (self.isReuseOfPanesScheduled) {
+        return;
+    }
+    
+    self.reuseOfPanesScheduled = YES;
+    
+    // Scroll views let go of removed panes on their next configuration pass, so wait for it:
+    __weak typeof(self) weakSelf = self;
+    
+    dispatch_async(dispatch_get_main_queue(), ^{
+        [weakSelf _recycleUnusedPanes];
+    });
+}
+
+- (void)_recycleUnusedPanes
+{
+    self.reuseOfPanesScheduled = NO;
+    
+    NSArray <MMSplitPaneView *> *panes = self.panesPendingReuse.copy;
+    
+    [self.panesPendingReuse removeAllObjects];
+    
+    // Removed panes have no owner left; the pool skips any that are still in a view hierarchy:
+    MMSplitReusePool *pool = [MMSplitReusePool sharedPool];
+    
+    for (MMSplitPaneView *pane in panes) {
+        [pool recycleView:pane];
+    }
+}
+
+#pragma mark - <MMSplitScrollViewDelegate>
+
+- (void)scrollView:(MMSplitScrollView *)scrollView didEndDisplayingPages:(NSIndexSet *)removedPages willDisplayPages:(NSIndexSet *)insertedPages
+{
+    NSArray <UIView *> *panes = scrollView.panes;
+    
+    // Resolve each controller once, in page order:
+    NSMutableArray <UIViewController *> *disappearingViewControllers = [NSMutableArray arrayWithCapacity:removedPages.count];
+    NSMutableArray <MMSplitPaneView *> *disappearingPanes = [NSMutableArray arrayWithCapacity:removedPages.count];
+    NSMutableArray <UIViewController *> *appearingViewControllers = [NSMutableArray arrayWithCapacity:insertedPages.count];
+    NSMutableArray <MMSplitPaneView *> *appearingPanes = [NSMutableArray arrayWithCapacity:insertedPages.count];
+    
+    [removedPages enumerateIndexesUsingBlock:^(NSUInteger page, BOOL *stop) {
+        UIViewController *viewController = [self viewControllerForPage:page inScrollView:scrollView];
+    
+        if (viewController != nil && page < panes.count) {
+            [disappearingViewControllers addObject:viewController];
+            [disappearingPanes addObject:(MMSplitPaneView *)panes[page]];
+        }
+    }];
+    
+    [insertedPages enumerateIndexesUsingBlock:^(NSUInteger page, BOOL *stop) {
+        UIViewController *viewController = [self viewControllerForPage:page inScrollView:scrollView];
+        
+        if (viewController != nil && page < panes.count) {
+            [appearingViewControllers addObject:viewController];
+            [appearingPanes addObject:(MMSplitPaneView *)panes[page]];
+        }
+    }];
+    
+    if (appearingViewControllers.count > 0) {
+        if (_delegateFlags.delegateWillDisplayViewController) {
+            for (UIViewController *viewController in appearingViewControllers) {
+                [self.delegate splitViewController:self willDisplayViewController:viewController];
+            }
+        }
+        
+        [self willDisplayViewControllers:appearingViewControllers];
+        
+        for (UIViewController *viewController in appearingViewControllers) {
+            [self publishEventOfType:MMSplitEventTypeWillDisplay forViewController:viewController];
+        }
+    }
+
+    // Appearance transitions always run disappearing controllers first, then appearing ones:
+    const BOOL animated = (scrollView.isDecelerating || scrollView.isTracking);
+    
+    for (UIViewController *viewController in disappearingViewControllers) {
+        [viewController beginAppearanceTransition:NO animated:animated];
+    }
+    
+    for (UIViewController *viewController in appearingViewControllers) {
+        [viewController beginAppearanceTransition:YES animated:animated];
+    }
+    
+    [disappearingPanes enumerateObjectsUsingBlock:^(MMSplitPaneView *paneView, NSUInteger idx, BOOL *stop) {
+        if (paneView != self.primaryCollapsedPane) {
+            paneView.contentView = nil;
+        }
+    }];
+    
+    [appearingPanes enumerateObjectsUsingBlock:^(MMSplitPaneView *paneView, NSUInteger idx, BOOL *stop) {
+        if (paneView != self.primaryCollapsedPane && !paneView.contentView) {
+            paneView.contentView = appearingViewControllers[idx].view;
+        }
+    }];
+    
+    for (UIViewController *viewController in disappearingViewControllers) {
+        [viewController endAppearanceTransition];
+    }
+    
+    for (UIViewController *viewController in appearingViewControllers) {
+        [viewController endAppearanceTransition];
+    }
+    
+    for (UIViewController *viewController in disappearingViewControllers) {
+        if (_delegateFlags.delegateDidEndDisplayingViewController) {
+            [self.delegate splitViewController:self didEndDisplayingViewController:viewController];
+        }
+        
+        [self publishEventOfType:MMSplitEventTypeDidEndDisplaying forViewController:viewController];
+    }
+    
+    if (removedPages.count > 0 && self.dataSource != nil && scrollView == self.scrollView) {
+        [self _scheduleReleaseOfDistantViewControllers];
+    }
+    
+    [self _scheduleFootprintBudgetCheck];
+}
+
+- (CGSize)scrollView:(MMSplitScrollView *)scrollView sizeForView:(MMSplitPaneView *)view atPage:(NSInteger)page
+{
+    const CGFloat restoredWidth = [self restoredWidthForPage:page inScrollView:scrollView];
+    if (restoredWidth >= 0.0f) {
+        return (CGSize){ restoredWidth, scrollView.sizingBoundsSize.height };
+    }
+    
+    const CGSize boundsSize = scrollView.sizingBoundsSize;
+    
+    const CGFloat precomputedWidth = [self precomputedWidthForPage:page inScrollView:scrollView];
+    if (precomputedWidth >= 0.0f) {
+        return (CGSize){ precomputedWidth, boundsSize.height };
+    }
+    
+    const MMViewControllerColumnSize columnSize = [self columnSizeForPage:page inScrollView:scrollView];
+    
+    // Only secondary columns depend on the column next to them:
+    MMViewControllerColumnSize followingColumnSize = MMViewControllerColumnSizeDefault;
+    if (columnSize == MMViewControllerColumnSizeSecondary) {
+        followingColumnSize = [self columnSizeForPage:(page + 1) inScrollView:scrollView];
+    }
+    
+    const MMSplitColumnSizingContext context = [self columnSizingContextForBoundsSize:boundsSize];
+    const CGFloat width = [self widthForColumnSize:columnSize followingColumnSize:followingColumnSize context:context];
+    
+    return (CGSize){ width, boundsSize.height };
+}
+
+- (BOOL)scrollView:(MMSplitScrollView *)scrollView getWidths:(CGFloat *)widths count:(NSUInteger)count
+{
+    // Restored widths are matched page by page:
+    if (self.restoredSnapshot != nil || count != scrollView.panes.count) {
+        return NO;
+    }
+    
+    if ([self hasPrecomputedWidthsForScrollView:scrollView]) {
+        memcpy(widths, self.columnWidthTable.bytes, count * sizeof(CGFloat));
+        return YES;
+    }
+    
+    NSData *columnSizes = [self columnSizesForPagesInScrollView:scrollView];
+    const MMSplitColumnSizingContext context = [self columnSizingContextForBoundsSize:scrollView.sizingBoundsSize];
+    
+    MMSplitSolveColumnWidths(columnSizes.bytes, count, context, self.columnSizingProvider, widths);
+    
+    // Keep the result, so a background pass for the same inputs doesn't lay out again:
+    if (self.columnSizingProvider != nil && scrollView == self.scrollView) {
+        self.columnWidthTable = [NSData dataWithBytes:widths length:count * sizeof(CGFloat)];
+        self.columnWidthTableContext = context;
+        self.columnWidthTableInputsGeneration = self.configurationInputsGeneration;
+    }
+    
+    return YES;
+}
+
+- (void)scrollView:(MMSplitScrollView *)scrollView willSnapToView:(UIView *)view atPage:(NSInteger)page
+{
+    UIViewController *viewController = [self viewControllerForPage:page inScrollView:scrollView];
+    
+    [self willSnapToViewController:viewController];
+    
+    if (_delegateFlags.delegateWillSnapToViewController) {
+        [self.delegate splitViewController:self willSnapToViewController:viewController];
+    }
+    
+    [self publishEventOfType:MMSplitEventTypeWillSnap forViewController:viewController];
+}
+
+- (void)scrollView:(MMSplitScrollView *)scrollView didSnapToView:(UIView *)view atPage:(NSInteger)page
+{
+    if (_delegateFlags.delegateDidSnapToViewController || self.eventStream != nil) {
+        UIViewController *viewController = [self viewControllerForPage:page inScrollView:scrollView];
+        
+        if (_delegateFlags.delegateDidSnapToViewController) {
+            [self.delegate splitViewController:self didSnapToViewController:viewController];
+        }
+        
+        [self publishEventOfType:MMSplitEventTypeDidSnap forViewController:viewController];
+    }
+}
+
+#pragma mark - <UIScrollViewDelegate>
+
+- (void)scrollViewDidScroll:(UIScrollView *)scrollView
+{
+    static BOOL invalidateSafeAreaInvocationNeeded;
+    static SEL invalidateSafeAreaSelector;
+    static dispatch_once_t onceToken;
+    dispatch_once(&onceToken, ^{
+        NSString *invalidateSafeAreaSelectorString = [@[ @"_updateCont", @"entOverlayInsetsF", @"orSelfAndChildren" ] componentsJoinedByString:@""];
+
+        invalidateSafeAreaSelector = NSSelectorFromString(invalidateSafeAreaSelectorString);
+        invalidateSafeAreaInvocationNeeded = [UIScrollView instancesRespondToSelector:@selector(safeAreaInsets)] && [self respondsToSelector:invalidateSafeAreaSelector];
+    });
+
+    if (invalidateSafeAreaInvocationNeeded) {
+#pragma clang diagnostic push
+#pragma clang diagnostic ignored "-Warc-performSelector-leaks"
+        [self performSelector:invalidateSafeAreaSelector];
+#pragma clang diagnostic pop
+    }
+}
+
+#pragma mark - Data source.
+
+- (void)setDataSource:(id<MMSplitViewControllerDataSource>)dataSource
+{
+    if (dataSource != _dataSource) {
+        // End and release the columns of the previous data source while it can still be told about them:
+        [self _endDisplayingVisibleColumns];
+        [self releaseMaterializedViewControllersOutsideRange:NSMakeRange(0, 0)];
+        
+        if (dataSource != nil && _dataSource == nil) {
+            self.viewControllers = @[];
+        }
+        
+        _dataSource = dataSource;
+        
+        [self reloadData];
+    }
+}
+
+- (void)reloadData
+{
+    self.resolvedColumnSizesValid = NO;
+    
+    [self _endDisplayingVisibleColumns];
+    [self releaseMaterializedViewControllersOutsideRange:NSMakeRange(0, 0)];
+    
+    const NSInteger numberOfColumns = (self.dataSource != nil) ? MAX([self.dataSource numberOfColumnsInSplitViewController:self], 0) : 0;
+    
+    // Panes are cheap, so keep one per column to let scrolling and snapping work on the whole stack:
+    NSArray <MMSplitPaneView *> *previousColumnPanes = self.columnPanes;
+    NSMutableArray <MMSplitPaneView *> *columnPanes = [NSMutableArray arrayWithCapacity:numberOfColumns];
+    
+    for (NSInteger idx = 0; idx < numberOfColumns; idx++) {
+        if (idx < (NSInteger)previousColumnPanes.count) {
+            [columnPanes addObject:previousColumnPanes[idx]];
+        } else {
+            [columnPanes addObject:[self _dequeuePane]];
+        }
+    }
+    
+    if (previousColumnPanes.count > (NSUInteger)numberOfColumns) {
+        [self _recyclePanesWhenUnused:[previousColumnPanes subarrayWithRange:NSMakeRange(numberOfColumns, previousColumnPanes.count - numberOfColumns)]];
+    }
+    
+    self.columnPanes = columnPanes;
+    self.configurationInputsGeneration += 1;
+    
+    [self _configureScrollViewWithTraitCollection:self.traitCollection];
+    [self invalidateColumnSizes];
+    
+    // Panes that stayed on screen won't be displayed again by the scroll view, so fill them now:
+    MMSplitScrollView *scrollView = self.scrollView;
+    const NSRange visibleRange = scrollView.rangeForVisiblePanes;
+    
+    if (visibleRange.length > 0) {
+        [self scrollView:scrollView didEndDisplayingPages:[NSIndexSet indexSet] willDisplayPages:[NSIndexSet indexSetWithIndexesInRange:visibleRange]];
+    }
+}
+
+- (void)_endDisplayingVisibleColumns
+{
+    if (self.dataSource == nil || !self.isViewLoaded) {
+        return;
+    }
+    
+    MMSplitScrollView *scrollView = self.scrollView;
+    const NSRange visibleRange = scrollView.rangeForVisiblePanes;
+    
+    NSMutableIndexSet *materializedPages = [NSMutableIndexSet indexSet];
+    
+    for (NSUInteger idx = visibleRange.location; idx < NSMaxRange(visibleRange); idx++) {
+        if (self.materializedViewControllers[@(idx)] != nil) {
+            [materializedPages addIndex:idx];
+        }
+    }
+    
+    if (materializedPages.count > 0) {
+        [self scrollView:scrollView didEndDisplayingPages:materializedPages willDisplayPages:[NSIndexSet indexSet]];
+    }
+}
+
+- (UIViewController *)materializeViewControllerForColumnAtIndex:(NSUInteger)index
+{
+    if (index >= self.columnPanes.count) {
+        return nil;
+    }
+    
+    UIViewController *viewController = self.materializedViewControllers[@(index)];
+    
+    if (!viewController) {
+        viewController = [self.dataSource splitViewController:self viewControllerForColumnAtIndex:index];
+        
+        if (viewController != nil) {
+            [viewController willMoveToParentViewController:self];
+            [self addChildViewController:viewController];
+            [viewController didMoveToParentViewController:self];
+            
+            self.materializedViewControllers[@(index)] = viewController;
+            
+            [self.indexesForMaterializedViewControllers setObject:@(index) forKey:viewController];
+            [self.panes setObject:self.columnPanes[index] forKey:viewController];
+        }
+    }
+    
+    return viewController;
+}
+
+- (NSUInteger)indexOfColumnForViewController:(UIViewController *)viewController
+{
+    if (self.dataSource != nil) {
+        NSNumber *index = [self.indexesForMaterializedViewControllers objectForKey:viewController];
+        
+        return (index != nil) ? index.unsignedIntegerValue : NSNotFound;
+    }
+    return [self.viewControllers indexOfObject:viewController];
+}
+
+- (void)_scheduleReleaseOfDistantViewControllers
+{
+    if (self.isReleaseOfDistantViewControllersScheduled) {
+        return;
+    }
+    
+    self.releaseOfDistantViewControllersScheduled = YES;
+    
+    // Wait for the scroll view to finish updating the visible range:
+    __weak typeof(self) weakSelf = self;
+    
+    dispatch_async(dispatch_get_main_queue(), ^{
+        [weakSelf _releaseDistantViewControllers];
+    });
+}
+
+- (void)_releaseDistantViewControllers
+{
+    self.releaseOfDistantViewControllersScheduled = NO;
+    
+    if (self.dataSource == nil) {
+        return;
+    }
+    
+    const NSRange visibleRange = self.scrollView.rangeForVisiblePanes;
+    
+    if (visibleRange.length == 0) {
+        return;
+    }
+    
+    const NSUInteger margin = MMSplitViewControllerMaterializedColumnMargin;
+    const NSUInteger location = (visibleRange.location > margin) ? (visibleRange.location - margin) : 0;
+    const NSUInteger length = (NSMaxRange(visibleRange) + margin) - location;
+    
+    [self releaseMaterializedViewControllersOutsideRange:NSMakeRange(location, length)];
+}
+
+- (void)releaseMaterializedViewControllersOutsideRange:(NSRange)range
+{
+    const NSRange visibleRange = self.scrollView.rangeForVisiblePanes;
+    
+    for (NSNumber *index in self.materializedViewControllers.allKeys) {
+        const NSUInteger idx = index.unsignedIntegerValue;
+        
+        // Never release a view controller that is still on screen:
+        if (NSLocationInRange(idx, range) || (range.length > 0 && NSLocationInRange(idx, visibleRange))) {
+            continue;
+        }
+        
+        UIViewController *viewController = self.materializedViewControllers[index];
+        MMSplitPaneView *pane = [self.panes objectForKey:viewController];
+        
+        if (viewController.isViewLoaded && pane.contentView == viewController.view) {
+            pane.contentView = nil;
+        }
+        
+        [viewController willMoveToParentViewController:nil];
+        [viewController removeFromParentViewController];
+        
+        [self.materializedViewControllers removeObjectForKey:index];
+        [self.indexesForMaterializedViewControllers removeObjectForKey:viewController];
+        [self.panes removeObjectForKey:viewController];
+        
+        if ([self.dataSource respondsToSelector:@selector(splitViewController:didReleaseViewController:forColumnAtIndex:)]) {
+            [self.dataSource splitViewController:self didReleaseViewController:viewController forColumnAtIndex:idx];
+        }
+    }
+}
+
+- (void)scrollToColumnAtIndex:(NSInteger)index animated:(BOOL)animated
+{
+    MMSplitScrollView *scrollView = self.scrollView;
+    
+    if (self.dataSource == nil || index < 0 || index >= (NSInteger)scrollView.panes.count) {
+        return;
+    }
+    
+    [scrollView scrollToPane:scrollView.panes[index] animated:animated];
+}
+
+#pragma mark - Showing view controllers:
+
+- (UIViewController *)targetViewControllerForAction:(SEL)action sender:(id)sender
+{
+    if (action == @selector(showViewController:sender:)) {
+        return self;
+    }
+    return [super targetViewControllerForAction:action sender:sender];
+}
+
+- (void)showViewController:(UIViewController *)vc sender:(id)sender
+{
+    if (!vc) {
+        return;
+    }
+    
+    // Columns supplied by a data source can't be appended to:
+    if (![self.viewControllers containsObject:vc] && self.dataSource == nil) {
+        self.viewControllers = [self.viewControllers arrayByAddingObject:vc];
+    }
+    
+    [self scrollToViewController:vc animated:YES];
+}
+
+- (void)scrollToViewController:(UIViewController *)viewController animated:(BOOL)animated
+{
+    if (![self.viewControllers containsObject:viewController]) {
+        return;
+    }
+    
+    // Coalesce successive requests so only the last destination is scrolled to:
+    self.pendingScrollViewController = viewController;
+    self.pendingScrollAnimated = animated;
+    
+    if (!animated) {
+        [self _performPendingScroll];
+        return;
+    }
+    
+    if (!self.isPendingScrollScheduled) {
+        self.pendingScrollScheduled = YES;
+        
+        __weak typeof(self) weakSelf = self;
+        
+        dispatch_async(dispatch_get_main_queue(), ^{
+            [weakSelf _performPendingScroll];
+        });
+    }
+}
+
+- (void)_performPendingScroll
+{
+    UIViewController *viewController = self.pendingScrollViewController;
+    const BOOL animated = self.pendingScrollAnimated;
+    
+    self.pendingScrollViewController = nil;
+    self.pendingScrollScheduled = NO;
+    
+    if (!viewController || ![self.viewControllers containsObject:viewController]) {
+        return;
+    }
+    
+    if ([self.primaryCollapsedViewControllers containsObject:viewController]) {
+        const NSInteger idx = [self.primaryCollapsedViewControllers indexOfObject:viewController];
+        
+        // The nested scroll view is only worth animating if the collapsed pane is already on screen:
+        const NSRange visibleRange = self.scrollView.rangeForVisiblePanes;
+        const BOOL collapsedPaneVisible = (visibleRange.length > 0 && visibleRange.location == 0);
+        
+        // First, scroll the primary collapsed pane into view:
+        [self.scrollView scrollToPane:self.primaryCollapsedPane animated:animated];
+        
+        // Actually scroll to the view controller's pane:
+        [self.primaryCollapsedScrollView scrollToPane:self.primaryCollapsedScrollView.panes[idx] animated:(animated && collapsedPaneVisible)];
+        return;
+    }
+    
+    NSInteger page = [self indexOfColumnForViewController:viewController];
+    
+    if (self.primaryCollapsedViewControllers.count > 0) {
+        page = page - (self.primaryCollapsedViewControllers.count - 1);
+    }
+    
+    [self.scrollView scrollToPane:self.scrollView.panes[page] animated:animated];
+}
+
+- (BOOL)canToggleVisibilityForViewController:(UIViewController *)viewController
+{
+    if (![self.viewControllers containsObject:viewController]) {
+        return NO;
+    }
+    
+    if (self.displayMode == MMViewControllerDisplayModeSinglePage) {
+        return ([self indexOfColumnForViewController:viewController] != 0);
+    }
+    
+    if ([self.primaryCollapsedViewControllers containsObject:viewController]) {
+        return YES;
+    }
+    
+    UIView *pane = [self.panes objectForKey:viewController];
+    MMSplitScrollView *scrollView = self.scrollView;
+    
+    const CGRect paneRect = [scrollView rectForPane:pane];
+    const CGFloat maximumContentOffsetX = -(scrollView.contentSize.width - CGRectGetWidth(scrollView.bounds));
+    const BOOL scrollingPastPaneIsPossible = -CGRectGetMinX(paneRect) >= maximumContentOffsetX;
+    
+    return (scrollingPastPaneIsPossible);
+}
+
+- (void)setIncludesOpaqueRoundedCornersOverlay:(BOOL)flag
 {
     if (flag != _includesOpaqueRoundedCornersOverlay) {
         _includesOpaqueRoundedCornersOverlay = flag;
@@ -700,6 +1795,16 @@ NS_INLINE CGFloat MMSplitDimensionUsingDefaultValue(CGFloat value, CGFloat defau
     }
 }
 
+- (void)setUsesSharedChromeRenderer:(BOOL)usesSharedChromeRenderer
+{
+    if (usesSharedChromeRenderer != _usesSharedChromeRenderer) {
+        _usesSharedChromeRenderer = usesSharedChromeRenderer;
+        
+        _scrollView.usesSharedChromeRenderer = usesSharedChromeRenderer;
+        _primaryCollapsedScrollView.usesSharedChromeRenderer = usesSharedChromeRenderer;
+    }
+}
+
 - (void)setDisablesInteractiveSnapGestures:(BOOL)disablesInteractiveSnapGestures
 {
     if (disablesInteractiveSnapGestures != _disablesInteractiveSnapGestures) {
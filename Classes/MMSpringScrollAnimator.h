@@ -37,6 +37,11 @@
  */
 @property (readonly, nonatomic) BOOL isAnimating;
 
+/**
+ *  The content offset at which the current animation stops.
+ */
+@property (readonly, nonatomic) CGPoint destinationContentOffset;
+
 /**
  *  Starts the animation an finished at the specified content offset.
  *
@@ -45,6 +50,15 @@
  */
 - (void)animateScrollToContentOffset:(CGPoint)contentOffset duration:(NSTimeInterval)duration;
 
+/**
+ *  Starts the animation an finished at the specified content offset, continuing from the current motion of the scroll view.
+ *
+ *  @param contentOffset The content offset at which stop animating.
+ *  @param duration      The total duration of the animation, measured in seconds.
+ *  @param velocity      The current velocity of the content, in points per second. Used instead of @c -initialVelocity to seed the spring.
+ */
+- (void)animateScrollToContentOffset:(CGPoint)contentOffset duration:(NSTimeInterval)duration velocity:(CGPoint)velocity;
+
 /**
  *  Stops the animation at its current state.
  *
@@ -15,10 +15,11 @@
 @property (strong, nonatomic) CADisplayLink *displayLink;
 
 @property (assign, nonatomic) CGPoint contentOffset;
-@property (assign, nonatomic) CGPoint destinationContentOffset;
+@property (assign, nonatomic, readwrite) CGPoint destinationContentOffset;
 
 @property (assign, nonatomic) CFTimeInterval beginTime;
 @property (assign, nonatomic) CFTimeInterval duration;
+@property (assign, nonatomic) CGFloat animationInitialVelocity;
 
 @end
 
@@ -43,10 +44,37 @@
 }
 
 - (void)animateScrollToContentOffset:(CGPoint)contentOffset duration:(NSTimeInterval)duration
+{
+    [self _animateScrollToContentOffset:contentOffset duration:duration initialVelocity:self.initialVelocity];
+}
+
+- (void)animateScrollToContentOffset:(CGPoint)contentOffset duration:(NSTimeInterval)duration velocity:(CGPoint)velocity
+{
+    const CGPoint from = self.scrollView.contentOffset;
+    const CGFloat deltaX = contentOffset.x - from.x;
+    const CGFloat deltaY = contentOffset.y - from.y;
+    const CGFloat distanceSquared = (deltaX * deltaX) + (deltaY * deltaY);
+    
+    CGFloat initialVelocity = self.initialVelocity;
+    
+    if (distanceSquared > 0.0f && duration > 0.0) {
+        // The spring moves a unit distance in a unit of time, so project the velocity on the direction of travel and scale it:
+        initialVelocity = (((velocity.x * deltaX) + (velocity.y * deltaY)) / distanceSquared) * duration;
+        
+        // Keep a fast fling onto a close target from overshooting too far:
+        const CGFloat maximumVelocity = sqrtf(self.stiffness / self.mass);
+        initialVelocity = MAX(MIN(initialVelocity, maximumVelocity), -maximumVelocity);
+    }
+    
+    [self _animateScrollToContentOffset:contentOffset duration:duration initialVelocity:initialVelocity];
+}
+
+- (void)_animateScrollToContentOffset:(CGPoint)contentOffset duration:(NSTimeInterval)duration initialVelocity:(CGFloat)initialVelocity
 {
     self.contentOffset = self.scrollView.contentOffset;
     self.duration = duration;
     self.beginTime = 0.0;
+    self.animationInitialVelocity = initialVelocity;
     
     if (CGPointEqualToPoint(contentOffset, self.contentOffset)) {
         return;
@@ -85,7 +113,7 @@
                 CGFloat b = self.damping;
                 CGFloat m = self.mass;
                 CGFloat k = self.stiffness;
-                CGFloat v0 = self.initialVelocity;
+                CGFloat v0 = self.animationInitialVelocity;
                 
                 CGFloat beta = b / (2.0f * m);
                 CGFloat omega0 = sqrtf(k / m);
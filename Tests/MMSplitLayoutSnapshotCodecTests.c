@@ -0,0 +1,304 @@
+//
+//  MMSplitLayoutSnapshotCodecTests.c
+//  MMSplitViewController
+//
+//  Created by Matías Martínez on 3/13/19.
+//  Copyright © 2019 Matías. All rights reserved.
+//
+
+#include "MMSplitLayoutSnapshotCodec.h"
+#include <math.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+static int failureCount = 0;
+
+#define MMExpect(condition) do { \
+    if (!(condition)) { \
+        fprintf(stderr, "%s:%d: %s: expected %s\n", __FILE__, __LINE__, __func__, #condition); \
+        failureCount += 1; \
+    } \
+} while (0)
+
+// MARK: - Helpers.
+
+static const uint8_t MMTestColumnSizes[] = { 0, 1, 2, 1 };
+static const float MMTestPaneWidths[] = { 320.0f, 703.5f, 0.0f };
+
+static MMSplitLayoutSnapshotHeader MMTestHeader(void)
+{
+    return (MMSplitLayoutSnapshotHeader){
+        .displayMode = 2,
+        .boundsWidth = 1024.0f,
+        .boundsHeight = 768.0f,
+        .contentOffsetX = 320.0f,
+        .contentOffsetY = 0.0f,
+        .snappedIndex = 1,
+        .primaryCollapsedCount = 2,
+        .columnCount = 4,
+        .paneCount = 3
+    };
+}
+
+static uint8_t *MMTestEncode(const MMSplitLayoutSnapshotHeader *header, const uint8_t *columnSizes, const float *paneWidths, size_t *length)
+{
+    *length = (size_t)MMSplitLayoutSnapshotEncodedLength(header);
+
+    uint8_t *bytes = malloc(*length);
+    MMSplitLayoutSnapshotEncode(header, columnSizes, paneWidths, bytes);
+
+    return bytes;
+}
+
+static void MMTestWriteUInt32(uint8_t *bytes, uint32_t value)
+{
+    bytes[0] = (uint8_t)(value & 0xFF);
+    bytes[1] = (uint8_t)(value >> 8);
+    bytes[2] = (uint8_t)(value >> 16);
+    bytes[3] = (uint8_t)(value >> 24);
+}
+
+static void MMTestWriteFloat32(uint8_t *bytes, float value)
+{
+    uint32_t bits;
+    memcpy(&bits, &value, sizeof(bits));
+    MMTestWriteUInt32(bytes, bits);
+}
+
+static int MMTestDecode(const uint8_t *bytes, size_t length, MMSplitLayoutSnapshotHeader *header, uint8_t *columnSizes, float *paneWidths)
+{
+    return MMSplitLayoutSnapshotDecodeHeader(bytes, length, header) && MMSplitLayoutSnapshotDecodeBody(bytes, length, header, columnSizes, paneWidths);
+}
+
+// MARK: - Round trips.
+
+static void testRoundTrip(void)
+{
+    const MMSplitLayoutSnapshotHeader header = MMTestHeader();
+
+    size_t length = 0;
+    uint8_t *bytes = MMTestEncode(&header, MMTestColumnSizes, MMTestPaneWidths, &length);
+
+    MMExpect(length == MMSplitLayoutSnapshotCodecHeaderLength + 4 + 3 * 4);
+
+    MMSplitLayoutSnapshotHeader decoded;
+    uint8_t columnSizes[4] = { 0 };
+    float paneWidths[3] = { 0 };
+
+    MMExpect(MMTestDecode(bytes, length, &decoded, columnSizes, paneWidths));
+    MMExpect(decoded.displayMode == header.displayMode);
+    MMExpect(decoded.boundsWidth == header.boundsWidth);
+    MMExpect(decoded.boundsHeight == header.boundsHeight);
+    MMExpect(decoded.contentOffsetX == header.contentOffsetX);
+    MMExpect(decoded.contentOffsetY == header.contentOffsetY);
+    MMExpect(decoded.snappedIndex == header.snappedIndex);
+    MMExpect(decoded.primaryCollapsedCount == header.primaryCollapsedCount);
+    MMExpect(decoded.columnCount == header.columnCount);
+    MMExpect(decoded.paneCount == header.paneCount);
+    MMExpect(memcmp(columnSizes, MMTestColumnSizes, sizeof(columnSizes)) == 0);
+    MMExpect(memcmp(paneWidths, MMTestPaneWidths, sizeof(paneWidths)) == 0);
+
+    free(bytes);
+}
+
+static void testRoundTripEmpty(void)
+{
+    const MMSplitLayoutSnapshotHeader header = (MMSplitLayoutSnapshotHeader){
+        .snappedIndex = MMSplitLayoutSnapshotCodecNotFound
+    };
+
+    size_t length = 0;
+    uint8_t *bytes = MMTestEncode(&header, NULL, NULL, &length);
+
+    MMExpect(length == MMSplitLayoutSnapshotCodecHeaderLength);
+
+    MMSplitLayoutSnapshotHeader decoded;
+
+    MMExpect(MMTestDecode(bytes, length, &decoded, NULL, NULL));
+    MMExpect(decoded.snappedIndex == MMSplitLayoutSnapshotCodecNotFound);
+    MMExpect(decoded.columnCount == 0 && decoded.paneCount == 0);
+
+    free(bytes);
+}
+
+static void testLittleEndianLayout(void)
+{
+    const MMSplitLayoutSnapshotHeader header = MMTestHeader();
+
+    size_t length = 0;
+    uint8_t *bytes = MMTestEncode(&header, MMTestColumnSizes, MMTestPaneWidths, &length);
+
+    // The format is fixed regardless of the host byte order:
+    const uint8_t expectedPrefix[] = { 'M', 'M', 'S', 'L', 0x01, 0x00, 0x02, 0x00 };
+
+    MMExpect(memcmp(bytes, expectedPrefix, sizeof(expectedPrefix)) == 0);
+    MMExpect(bytes[32] == 4 && bytes[33] == 0 && bytes[34] == 0 && bytes[35] == 0);
+    MMExpect(bytes[36] == 3 && bytes[37] == 0 && bytes[38] == 0 && bytes[39] == 0);
+
+    free(bytes);
+}
+
+// MARK: - Malformed data.
+
+static void testTruncatedData(void)
+{
+    const MMSplitLayoutSnapshotHeader header = MMTestHeader();
+
+    size_t length = 0;
+    uint8_t *bytes = MMTestEncode(&header, MMTestColumnSizes, MMTestPaneWidths, &length);
+
+    MMSplitLayoutSnapshotHeader decoded;
+
+    for (size_t truncatedLength = 0; truncatedLength < length; truncatedLength++) {
+        MMExpect(!MMSplitLayoutSnapshotDecodeHeader(bytes, truncatedLength, &decoded));
+    }
+
+    MMExpect(!MMSplitLayoutSnapshotDecodeHeader(NULL, 0, &decoded));
+
+    free(bytes);
+}
+
+static void testTrailingData(void)
+{
+    const MMSplitLayoutSnapshotHeader header = MMTestHeader();
+
+    size_t length = 0;
+    uint8_t *bytes = MMTestEncode(&header, MMTestColumnSizes, MMTestPaneWidths, &length);
+    uint8_t *padded = calloc(length + 1, 1);
+
+    memcpy(padded, bytes, length);
+
+    MMSplitLayoutSnapshotHeader decoded;
+
+    MMExpect(!MMSplitLayoutSnapshotDecodeHeader(padded, length + 1, &decoded));
+
+    free(padded);
+    free(bytes);
+}
+
+static void testOversizedCounts(void)
+{
+    const MMSplitLayoutSnapshotHeader header = MMTestHeader();
+
+    size_t length = 0;
+    uint8_t *bytes = MMTestEncode(&header, MMTestColumnSizes, MMTestPaneWidths, &length);
+
+    MMSplitLayoutSnapshotHeader decoded;
+
+    // Counts that would overflow a 32-bit length computation still have to match the data:
+    MMTestWriteUInt32(bytes + 32, UINT32_MAX);
+    MMExpect(!MMSplitLayoutSnapshotDecodeHeader(bytes, length, &decoded));
+
+    MMTestWriteUInt32(bytes + 32, header.columnCount);
+    MMTestWriteUInt32(bytes + 36, UINT32_MAX);
+    MMExpect(!MMSplitLayoutSnapshotDecodeHeader(bytes, length, &decoded));
+
+    MMTestWriteUInt32(bytes + 36, 0x40000000 + header.paneCount);
+    MMExpect(!MMSplitLayoutSnapshotDecodeHeader(bytes, length, &decoded));
+
+    MMTestWriteUInt32(bytes + 36, header.paneCount);
+    MMTestWriteUInt32(bytes + 28, header.columnCount + 1);
+    MMExpect(!MMSplitLayoutSnapshotDecodeHeader(bytes, length, &decoded));
+
+    free(bytes);
+}
+
+static void testBadMagicAndVersion(void)
+{
+    const MMSplitLayoutSnapshotHeader header = MMTestHeader();
+
+    size_t length = 0;
+    uint8_t *bytes = MMTestEncode(&header, MMTestColumnSizes, MMTestPaneWidths, &length);
+
+    MMSplitLayoutSnapshotHeader decoded;
+
+    bytes[0] ^= 0xFF;
+    MMExpect(!MMSplitLayoutSnapshotDecodeHeader(bytes, length, &decoded));
+    bytes[0] ^= 0xFF;
+
+    bytes[4] = MMSplitLayoutSnapshotCodecVersion + 1;
+    MMExpect(!MMSplitLayoutSnapshotDecodeHeader(bytes, length, &decoded));
+
+    bytes[4] = MMSplitLayoutSnapshotCodecVersion;
+    bytes[5] = 0x01;
+    MMExpect(!MMSplitLayoutSnapshotDecodeHeader(bytes, length, &decoded));
+
+    bytes[5] = 0x00;
+    MMExpect(MMSplitLayoutSnapshotDecodeHeader(bytes, length, &decoded));
+
+    free(bytes);
+}
+
+static void testNonFiniteFloats(void)
+{
+    const MMSplitLayoutSnapshotHeader header = MMTestHeader();
+    const float invalidValues[] = { NAN, INFINITY, -INFINITY };
+    const size_t headerFloatOffsets[] = { 8, 12, 16, 20 };
+
+    size_t length = 0;
+    uint8_t *bytes = MMTestEncode(&header, MMTestColumnSizes, MMTestPaneWidths, &length);
+    uint8_t *corrupted = malloc(length);
+
+    MMSplitLayoutSnapshotHeader decoded;
+    uint8_t columnSizes[4];
+    float paneWidths[3];
+
+    for (size_t valueIndex = 0; valueIndex < sizeof(invalidValues) / sizeof(invalidValues[0]); valueIndex++) {
+        for (size_t offsetIndex = 0; offsetIndex < sizeof(headerFloatOffsets) / sizeof(headerFloatOffsets[0]); offsetIndex++) {
+            memcpy(corrupted, bytes, length);
+            MMTestWriteFloat32(corrupted + headerFloatOffsets[offsetIndex], invalidValues[valueIndex]);
+
+            MMExpect(!MMSplitLayoutSnapshotDecodeHeader(corrupted, length, &decoded));
+        }
+
+        // Pane widths come after the column sizes:
+        for (uint32_t pane = 0; pane < header.paneCount; pane++) {
+            memcpy(corrupted, bytes, length);
+            MMTestWriteFloat32(corrupted + MMSplitLayoutSnapshotCodecHeaderLength + header.columnCount + pane * 4, invalidValues[valueIndex]);
+
+            MMExpect(!MMTestDecode(corrupted, length, &decoded, columnSizes, paneWidths));
+        }
+    }
+
+    free(corrupted);
+    free(bytes);
+}
+
+static void testNegativePaneWidth(void)
+{
+    const MMSplitLayoutSnapshotHeader header = MMTestHeader();
+    const float paneWidths[] = { 320.0f, -1.0f, 100.0f };
+
+    size_t length = 0;
+    uint8_t *bytes = MMTestEncode(&header, MMTestColumnSizes, paneWidths, &length);
+
+    MMSplitLayoutSnapshotHeader decoded;
+    uint8_t decodedColumnSizes[4];
+    float decodedPaneWidths[3];
+
+    MMExpect(!MMTestDecode(bytes, length, &decoded, decodedColumnSizes, decodedPaneWidths));
+
+    free(bytes);
+}
+
+int main(void)
+{
+    testRoundTrip();
+    testRoundTripEmpty();
+    testLittleEndianLayout();
+    testTruncatedData();
+    testTrailingData();
+    testOversizedCounts();
+    testBadMagicAndVersion();
+    testNonFiniteFloats();
+    testNegativePaneWidth();
+
+    if (failureCount > 0) {
+        fprintf(stderr, "%d expectation(s) failed\n", failureCount);
+        return EXIT_FAILURE;
+    }
+
+    printf("All snapshot codec tests passed\n");
+    return EXIT_SUCCESS;
+}
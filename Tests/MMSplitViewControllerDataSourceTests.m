@@ -0,0 +1,185 @@
+//
+//  MMSplitViewControllerDataSourceTests.m
+//  MMSplitViewControllerTests
+//
+//  Created by Matías Martínez on 3/13/19.
+//  Copyright © 2019 Matías. All rights reserved.
+//
+
+#import <XCTest/XCTest.h>
+#import "MMSplitViewController.h"
+
+@interface MMTestColumnDataSource : NSObject <MMSplitViewControllerDataSource>
+
+@property (assign, nonatomic) NSInteger numberOfColumns;
+@property (strong, nonatomic) NSMutableArray <UIViewController *> *vendedViewControllers;
+@property (strong, nonatomic) NSMutableArray <UIViewController *> *releasedViewControllers;
+@property (strong, nonatomic) NSMutableIndexSet *releasedIndexes;
+
+@end
+
+@implementation MMTestColumnDataSource
+
+- (instancetype)init
+{
+    self = [super init];
+    if (self) {
+        _numberOfColumns = 6;
+        _vendedViewControllers = [NSMutableArray array];
+        _releasedViewControllers = [NSMutableArray array];
+        _releasedIndexes = [NSMutableIndexSet indexSet];
+    }
+    return self;
+}
+
+- (NSInteger)numberOfColumnsInSplitViewController:(MMSplitViewController *)splitViewController
+{
+    return self.numberOfColumns;
+}
+
+- (MMViewControllerColumnSize)splitViewController:(MMSplitViewController *)splitViewController columnSizeForColumnAtIndex:(NSInteger)index
+{
+    return MMViewControllerColumnSizeDefault;
+}
+
+- (UIViewController *)splitViewController:(MMSplitViewController *)splitViewController viewControllerForColumnAtIndex:(NSInteger)index
+{
+    UIViewController *viewController = [[UIViewController alloc] init];
+    [self.vendedViewControllers addObject:viewController];
+    
+    return viewController;
+}
+
+- (void)splitViewController:(MMSplitViewController *)splitViewController didReleaseViewController:(UIViewController *)viewController forColumnAtIndex:(NSInteger)index
+{
+    [self.releasedViewControllers addObject:viewController];
+    [self.releasedIndexes addIndex:index];
+}
+
+@end
+
+@interface MMTestDisplayDelegate : NSObject <MMSplitViewControllerDelegate>
+
+@property (strong, nonatomic) NSMutableArray <UIViewController *> *endedViewControllers;
+
+@end
+
+@implementation MMTestDisplayDelegate
+
+- (instancetype)init
+{
+    self = [super init];
+    if (self) {
+        _endedViewControllers = [NSMutableArray array];
+    }
+    return self;
+}
+
+- (void)splitViewController:(MMSplitViewController *)splitViewController didEndDisplayingViewController:(UIViewController *)viewController
+{
+    [self.endedViewControllers addObject:viewController];
+}
+
+@end
+
+@interface MMSplitViewControllerDataSourceTests : XCTestCase
+
+@property (strong, nonatomic) UIWindow *window;
+@property (strong, nonatomic) MMSplitViewController *splitViewController;
+@property (strong, nonatomic) MMTestDisplayDelegate *displayDelegate;
+
+@end
+
+@implementation MMSplitViewControllerDataSourceTests
+
+- (void)setUp
+{
+    [super setUp];
+    
+    self.displayDelegate = [[MMTestDisplayDelegate alloc] init];
+    
+    self.splitViewController = [[MMSplitViewController alloc] init];
+    self.splitViewController.delegate = self.displayDelegate;
+    
+    self.window = [[UIWindow alloc] initWithFrame:CGRectMake(0.0f, 0.0f, 1024.0f, 768.0f)];
+    self.window.rootViewController = self.splitViewController;
+    self.window.hidden = NO;
+}
+
+- (void)tearDown
+{
+    self.window.hidden = YES;
+    self.window = nil;
+    self.splitViewController = nil;
+    self.displayDelegate = nil;
+    
+    [super tearDown];
+}
+
+- (MMTestColumnDataSource *)displayedDataSource
+{
+    MMTestColumnDataSource *dataSource = [[MMTestColumnDataSource alloc] init];
+    
+    self.splitViewController.dataSource = dataSource;
+    [self.splitViewController.view layoutIfNeeded];
+    
+    return dataSource;
+}
+
+#pragma mark - Tests.
+
+- (void)testSettingNilDataSourceEndsAndReleasesColumns
+{
+    MMTestColumnDataSource *dataSource = [self displayedDataSource];
+    NSArray <UIViewController *> *vendedViewControllers = dataSource.vendedViewControllers.copy;
+    
+    XCTAssertTrue(vendedViewControllers.count > 0);
+    
+    self.splitViewController.dataSource = nil;
+    
+    // Every column goes back to the data source that vended it:
+    XCTAssertEqualObjects([NSSet setWithArray:dataSource.releasedViewControllers], [NSSet setWithArray:vendedViewControllers]);
+    
+    // Visible columns end displaying before they are released:
+    XCTAssertTrue(self.displayDelegate.endedViewControllers.count > 0);
+    
+    for (UIViewController *viewController in self.displayDelegate.endedViewControllers) {
+        XCTAssertTrue([vendedViewControllers containsObject:viewController]);
+    }
+    
+    for (UIViewController *viewController in vendedViewControllers) {
+        XCTAssertNil(viewController.parentViewController);
+    }
+    
+    XCTAssertEqual(self.splitViewController.viewControllers.count, (NSUInteger)0);
+}
+
+- (void)testSwappingDataSourcesReleasesColumnsToThePreviousDataSource
+{
+    MMTestColumnDataSource *previousDataSource = [self displayedDataSource];
+    NSArray <UIViewController *> *previousViewControllers = previousDataSource.vendedViewControllers.copy;
+    
+    XCTAssertTrue(previousViewControllers.count > 0);
+    
+    MMTestColumnDataSource *dataSource = [[MMTestColumnDataSource alloc] init];
+    dataSource.numberOfColumns = 2;
+    
+    self.splitViewController.dataSource = dataSource;
+    
+    XCTAssertEqualObjects([NSSet setWithArray:previousDataSource.releasedViewControllers], [NSSet setWithArray:previousViewControllers]);
+    
+    XCTAssertTrue(self.displayDelegate.endedViewControllers.count > 0);
+    
+    for (UIViewController *viewController in self.displayDelegate.endedViewControllers) {
+        XCTAssertTrue([previousViewControllers containsObject:viewController]);
+    }
+    
+    // The new data source is never told about columns it didn't vend:
+    XCTAssertEqual(dataSource.releasedViewControllers.count, (NSUInteger)0);
+    
+    for (UIViewController *viewController in self.splitViewController.viewControllers) {
+        XCTAssertTrue([dataSource.vendedViewControllers containsObject:viewController]);
+    }
+}
+
+@end